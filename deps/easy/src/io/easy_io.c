@@ -1057,6 +1057,7 @@ static void easy_io_thread_destroy(easy_io_thread_t *ioth)
     }
     easy_spin_unlock(&ioth->thread_lock);
 
+    easy_message_pool_cache_destroy(ioth);
     easy_array_destroy(ioth->client_array);
 }
 
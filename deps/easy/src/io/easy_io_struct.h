@@ -258,6 +258,14 @@ struct easy_io_thread_t {
     uint64_t                rx_done_request_count;
     easy_atomic32_t         tx_conn_count;
     easy_atomic32_t         rx_conn_count;
+
+    // message pools kept for reuse, only touched by this thread
+    easy_pool_t             *msg_pool_cache;
+    int32_t                 msg_pool_cache_count;
+    int32_t                 msg_pool_cache_low;
+    uint64_t                msg_pool_cache_hit;
+    uint64_t                msg_pool_cache_miss;
+    uint64_t                msg_pool_cache_trim;
 };
 
 // 处理任务的线程
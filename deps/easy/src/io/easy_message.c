@@ -22,6 +22,99 @@
 easy_atomic_t easy_debug_uuid = 0;
 #endif
 
+/**
+ * 每个io线程缓存的message pool上限, 0表示不缓存
+ */
+int easy_message_pool_cache_limit = 64;
+
+static easy_io_thread_t *easy_message_pool_cache_self()
+{
+    return (easy_baseth_self && easy_baseth_self->iot) ? EASY_IOTH_SELF : NULL;
+}
+
+/**
+ * 优先从当前io线程的缓存中取一个大小一致的pool, 取不到再新建
+ */
+static easy_pool_t *easy_message_pool_create(uint32_t size)
+{
+    easy_io_thread_t        *ioth;
+    easy_pool_t             *pool;
+
+    ioth = easy_message_pool_cache_self();
+    pool = ioth ? ioth->msg_pool_cache : NULL;
+
+    if (pool && (uint32_t)(pool->end - (uint8_t *)pool) == easy_align(size + sizeof(easy_pool_t), EASY_POOL_ALIGNMENT)
+            && pool->mod_stat == easy_cur_mod_stat) {
+        ioth->msg_pool_cache = pool->next;
+        pool->next = NULL;
+        ioth->msg_pool_cache_hit++;
+
+        if (--ioth->msg_pool_cache_count < ioth->msg_pool_cache_low) {
+            ioth->msg_pool_cache_low = ioth->msg_pool_cache_count;
+        }
+    } else {
+        if (ioth) ioth->msg_pool_cache_miss++;
+
+        pool = easy_pool_create(size);
+    }
+
+    return pool;
+}
+
+/**
+ * 放回当前io线程的缓存, 超过上限或者不在io线程上直接释放
+ */
+static void easy_message_pool_destroy(easy_pool_t *pool)
+{
+    easy_io_thread_t        *ioth;
+
+    ioth = easy_message_pool_cache_self();
+
+    if (ioth && ioth->msg_pool_cache_count < easy_message_pool_cache_limit) {
+        easy_pool_reset(pool);
+        pool->next = ioth->msg_pool_cache;
+        ioth->msg_pool_cache = pool;
+        ioth->msg_pool_cache_count++;
+    } else {
+        if (ioth) ioth->msg_pool_cache_trim++;
+
+        easy_pool_destroy(pool);
+    }
+}
+
+/**
+ * 在io线程的定时器中调用, 释放上一周期一直没有被用到的pool的一半
+ */
+void easy_message_pool_cache_trim(easy_io_thread_t *ioth)
+{
+    easy_pool_t             *pool;
+    int32_t                 cnt;
+
+    cnt = (ioth->msg_pool_cache_low + 1) / 2;
+
+    while (cnt-- > 0 && (pool = ioth->msg_pool_cache) != NULL) {
+        ioth->msg_pool_cache = pool->next;
+        ioth->msg_pool_cache_count--;
+        ioth->msg_pool_cache_trim++;
+        easy_pool_destroy(pool);
+    }
+
+    ioth->msg_pool_cache_low = ioth->msg_pool_cache_count;
+}
+
+void easy_message_pool_cache_destroy(easy_io_thread_t *ioth)
+{
+    easy_pool_t             *pool;
+
+    while ((pool = ioth->msg_pool_cache) != NULL) {
+        ioth->msg_pool_cache = pool->next;
+        easy_pool_destroy(pool);
+    }
+
+    ioth->msg_pool_cache_count = 0;
+    ioth->msg_pool_cache_low = 0;
+}
+
 easy_message_t *easy_message_create_nlist(easy_connection_t *c)
 {
     easy_pool_t             *pool;
@@ -29,7 +122,7 @@ easy_message_t *easy_message_create_nlist(easy_connection_t *c)
     easy_buf_t              *input;
     int                     size;
 
-    if ((pool = easy_pool_create(c->default_msglen)) == NULL) {
+    if ((pool = easy_message_pool_create(c->default_msglen)) == NULL) {
         return NULL;
     }
 
@@ -41,7 +134,7 @@ easy_message_t *easy_message_create_nlist(easy_connection_t *c)
 
     if (m == NULL || input == NULL) {
         easy_error_log("Failed to alloc easy buffer due to OOM. System will crash.");
-        easy_pool_destroy(pool);
+        easy_message_pool_destroy(pool);
         return NULL;
     }
 
@@ -112,7 +205,7 @@ int easy_message_destroy(easy_message_t *m, int del)
             easy_debug_log("easy_message_destroy, m(%p), lbt(%s).", m, easy_lbt());
         }
         easy_debug_log("easy_message_destroy destroyed, m(%p), del(%d), ref(%ld).", m, del, m->pool->ref);
-        easy_pool_destroy(m->pool);
+        easy_message_pool_destroy(m->pool);
         return EASY_BREAK;
     }
 
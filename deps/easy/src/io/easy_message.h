@@ -25,6 +25,10 @@ EASY_CPP_START
 easy_message_t *easy_message_create(easy_connection_t *c);
 easy_message_t *easy_message_create_nlist(easy_connection_t *c);
 int easy_message_destroy(easy_message_t *m, int del);
+void easy_message_pool_cache_trim(easy_io_thread_t *ioth);
+void easy_message_pool_cache_destroy(easy_io_thread_t *ioth);
+
+extern int easy_message_pool_cache_limit;
 int easy_session_process(easy_session_t *s, int stop, int err);
 int easy_session_process_keep_connection_resilient(easy_session_t* s, int stop, int err);
 
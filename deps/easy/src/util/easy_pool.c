@@ -80,6 +80,18 @@ void easy_pool_clear(easy_pool_t *pool)
     pool->last = (uint8_t *) pool + sizeof(easy_pool_t);
 }
 
+// clear and make the pool look freshly created, so that it can be handed out again
+void easy_pool_reset(easy_pool_t *pool)
+{
+    easy_pool_clear(pool);
+    pool->flags = 0;
+    pool->ref = 0;
+    pool->tlock = 0;
+#ifdef EASY_DEBUG_MAGIC
+    pool->magic = EASY_DEBUG_MAGIC_POOL;
+#endif
+}
+
 void easy_pool_destroy(easy_pool_t *pool)
 {
     EASY_STAT_TIME_GUARD((ev_malloc_count++, ev_malloc_time += cost), "easy_pool_destroy");
@@ -79,6 +79,7 @@ extern void *easy_pool_default_realloc (void *ptr, size_t size);
 
 extern easy_pool_t *easy_pool_create(uint32_t size);
 extern void easy_pool_clear(easy_pool_t *pool);
+extern void easy_pool_reset(easy_pool_t *pool);
 extern void easy_pool_destroy(easy_pool_t *pool);
 extern void *easy_pool_alloc_ex(easy_pool_t *pool, uint32_t size, int align);
 extern void *easy_pool_calloc(easy_pool_t *pool, uint32_t size);
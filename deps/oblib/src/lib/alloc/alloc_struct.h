@@ -163,6 +163,8 @@ struct AChunk {
     struct {
       struct {
         uint8_t is_hugetlb_ : 1;
+        // numa node of the thread that mapped the chunk plus one, 0 if not bound
+        uint8_t numa_slot_ : 4;
       };
     };
   };
@@ -237,7 +239,12 @@ struct AObject {
     struct {
       struct {
         uint8_t on_leak_check_ : 1;
+        uint8_t from_tcache_ : 1;
       };
+      uint8_t reserved_;
+      // alloc_bytes_ the ObjectSet accounted for, kept once the object
+      // is handed out again by ObjectThreadCache
+      uint16_t set_bytes_;
     };
   };
 
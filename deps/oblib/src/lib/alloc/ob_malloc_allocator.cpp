@@ -18,6 +18,7 @@
 #include "lib/alloc/memory_sanity.h"
 #include "lib/utility/ob_tracepoint.h"
 #include "lib/allocator/ob_mem_leak_checker.h"
+#include "lib/allocator/ob_mem_sample_profiler.h"
 #include "lib/allocator/ob_page_manager.h"
 #include "lib/rc/ob_rc.h"
 #include "lib/rc/context.h"
@@ -90,6 +91,7 @@ void *ObMallocAllocator::alloc(const int64_t size, const oceanbase::lib::ObMemAt
     abort_unless(obj->MAGIC_CODE_ == AOBJECT_MAGIC_CODE
                  || obj->MAGIC_CODE_ == BIG_AOBJECT_MAGIC_CODE);
     get_mem_leak_checker().on_alloc(*obj, inner_attr);
+    ObMemSampleProfiler::get_instance().on_alloc(*obj, inner_attr);
   }
 
   return ptr;
@@ -133,6 +135,7 @@ void *ObMallocAllocator::realloc(
     abort_unless(obj->MAGIC_CODE_ == AOBJECT_MAGIC_CODE
                  || obj->MAGIC_CODE_ == BIG_AOBJECT_MAGIC_CODE);
     get_mem_leak_checker().on_alloc(*obj, inner_attr);
+    ObMemSampleProfiler::get_instance().on_alloc(*obj, inner_attr);
   }
   return nptr;;
 #endif
@@ -161,7 +164,13 @@ void ObMallocAllocator::free(void *ptr)
     abort_unless(block->obj_set_ != NULL);
 
     ObjectSet *set = block->obj_set_;
-    set->free_object(obj);
+    IBlockMgr *blk_mgr = set->get_block_mgr();
+    if (OB_NOT_NULL(blk_mgr)) {
+      // small objects go through the thread cache of their tenant ctx
+      static_cast<ObjectMgr&>(blk_mgr->get_tenant_ctx_allocator().get_block_mgr()).free_object(obj);
+    } else {
+      set->free_object(obj);
+    }
   }
 #endif // PERF_MODE
 }
@@ -492,3 +501,17 @@ int64_t ObMallocAllocator::sync_wash()
   }
   return washed_size;
 }
+
+void ObMallocAllocator::flush_object_thread_cache()
+{
+  for (int64_t slot = 0; slot < PRESERVED_TENANT_COUNT; ++slot) {
+    obsys::ObRLockGuard guard(locks_[slot]);
+    for (int64_t ctx_id = 0; ctx_id < ObCtxIds::MAX_CTX_ID; ctx_id++) {
+      ObTenantCtxAllocator *ta = allocators_[slot][ctx_id];
+      while (ta != nullptr) {
+        static_cast<ObjectMgr&>(ta->get_block_mgr()).flush_thread_cache();
+        ta = ta->get_next();
+      }
+    }
+  }
+}
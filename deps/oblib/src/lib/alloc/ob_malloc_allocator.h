@@ -68,6 +68,8 @@ public:
   int get_chunks(AChunk** chunks, int cap, int& cnt);
   int64_t sync_wash(uint64_t tenant_id, uint64_t from_ctx_id, int64_t wash_size);
   int64_t sync_wash();
+  // returns the objects kept by the thread caches of all tenant ctx to their sets
+  void flush_object_thread_cache();
   static uint64_t get_max_used_tenant_id() { return max_used_tenant_id_; }
   static bool is_inited_;
 private:
@@ -27,6 +27,7 @@ using namespace oceanbase::common;
 void ObTenantCtxAllocator::set_tenant_deleted()
 {
   ATOMIC_STORE(&has_deleted_, true);
+  obj_mgr_.disable_thread_cache();
   set_idle(0);
 }
 
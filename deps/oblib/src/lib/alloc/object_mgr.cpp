@@ -59,6 +59,168 @@ void SubObjectMgr::free_block(ABlock *block)
   bs_.free_block(block);
 }
 
+bool ObjectThreadCache::enabled_ = false;
+
+ObjectThreadCache::ObjectThreadCache()
+  : disabled_(false), slots_(nullptr)
+{
+}
+
+ObjectThreadCache::Slot *ObjectThreadCache::get_slot(const bool create)
+{
+  Slot *slots = ATOMIC_LOAD(&slots_);
+  if (OB_ISNULL(slots) && create) {
+    // slots live in the server tenant like SubObjectMgr, most tenant ctx never free small objects
+    auto *ta = ObMallocAllocator::get_instance()->get_tenant_ctx_allocator(OB_SERVER_TENANT_ID, ObCtxIds::DEFAULT_CTX_ID);
+    if (OB_NOT_NULL(ta)) {
+      auto &root_mgr = static_cast<ObjectMgr&>(ta->get_block_mgr()).root_mgr_;
+      ObMemAttr attr(OB_SERVER_TENANT_ID, LABEL, ObCtxIds::DEFAULT_CTX_ID);
+      root_mgr.lock();
+      auto *obj = root_mgr.alloc_object(sizeof(Slot) * SLOT_CNT, attr);
+      root_mgr.unlock();
+      if (OB_NOT_NULL(obj)) {
+        SANITY_UNPOISON(obj->data_, obj->alloc_bytes_);
+        MEMSET(obj->data_, 0, sizeof(Slot) * SLOT_CNT);
+        if (ATOMIC_BCAS(&slots_, nullptr, reinterpret_cast<Slot*>(obj->data_))) {
+          slots = reinterpret_cast<Slot*>(obj->data_);
+        } else {
+          SANITY_POISON(obj->data_, obj->alloc_bytes_);
+          root_mgr.free_object(obj);
+          slots = ATOMIC_LOAD(&slots_);
+        }
+      }
+    }
+  }
+  return OB_ISNULL(slots) ? nullptr : &slots[common::get_itid() % SLOT_CNT];
+}
+
+AObject *ObjectThreadCache::alloc_object(const uint32_t cells, const uint64_t size, const ObMemAttr &attr)
+{
+  AObject *obj = nullptr;
+  Slot *slot = get_slot(false);
+  if (OB_NOT_NULL(slot) && ATOMIC_BCAS(&slot->lock_, 0, 1)) {
+    AObject *&head = slot->lists_[cells / 2];
+    if (OB_NOT_NULL(obj = head)) {
+      head = obj->next_;
+      slot->cnts_[cells / 2]--;
+    }
+    ATOMIC_STORE(&slot->lock_, 0);
+  }
+  if (OB_NOT_NULL(obj)) {
+    abort_unless(obj->in_use_);
+    abort_unless(obj->nobjs_ == cells);
+    if (!obj->from_tcache_) {
+      obj->set_bytes_ = static_cast<uint16_t>(obj->alloc_bytes_);
+      obj->from_tcache_ = true;
+    }
+    obj->alloc_bytes_ = static_cast<uint32_t>(size);
+    reinterpret_cast<uint64_t&>(obj->data_[size]) = AOBJECT_TAIL_MAGIC_CODE;
+    if (attr.label_.str_ != nullptr) {
+      STRNCPY(&obj->label_[0], attr.label_.str_, sizeof(obj->label_));
+      obj->label_[sizeof(obj->label_) - 1] = '\0';
+    } else {
+      obj->label_[0] = '\0';
+    }
+  }
+  return obj;
+}
+
+bool ObjectThreadCache::free_object(AObject *obj)
+{
+  bool cached = false;
+  Slot *slot = nullptr;
+  if (!is_enabled() || ATOMIC_LOAD(&disabled_)
+      || obj->is_large_ || !is_cacheable(obj->nobjs_)) {
+    // do nothing
+  } else if (OB_ISNULL(slot = get_slot(true))) {
+    // do nothing
+  } else if (ATOMIC_BCAS(&slot->lock_, 0, 1)) {
+    AObject *batch = nullptr;
+    // checked again under the slot lock, flush may have drained the slot
+    if (!ATOMIC_LOAD(&disabled_)) {
+      abort_unless(AOBJECT_TAIL_MAGIC_CODE
+                   == reinterpret_cast<uint64_t&>(obj->data_[obj->alloc_bytes_]));
+      const uint32_t idx = obj->nobjs_ / 2;
+      STRNCPY(&obj->label_[0], LABEL, sizeof(obj->label_));
+      obj->label_[sizeof(obj->label_) - 1] = '\0';
+      obj->next_ = slot->lists_[idx];
+      slot->lists_[idx] = obj;
+      cached = true;
+      if (++slot->cnts_[idx] >= MAX_CACHE_CNT) {
+        // keep the recently freed half, which is more likely still in the cpu cache
+        AObject *last = slot->lists_[idx];
+        for (int i = 1; i < MAX_CACHE_CNT / 2; i++) {
+          last = last->next_;
+        }
+        batch = last->next_;
+        last->next_ = nullptr;
+        slot->cnts_[idx] = MAX_CACHE_CNT / 2;
+      }
+    }
+    ATOMIC_STORE(&slot->lock_, 0);
+    free_list(batch);
+  }
+  return cached;
+}
+
+void ObjectThreadCache::flush(const bool disable)
+{
+  if (disable) {
+    ATOMIC_STORE(&disabled_, true);
+  }
+  Slot *slots = ATOMIC_LOAD(&slots_);
+  for (int64_t i = 0; OB_NOT_NULL(slots) && i < SLOT_CNT; i++) {
+    Slot &slot = slots[i];
+    AObject *lists[MAX_CACHE_CELLS / 2 + 1];
+    while (!ATOMIC_BCAS(&slot.lock_, 0, 1)) {
+      PAUSE();
+    }
+    MEMCPY(lists, slot.lists_, sizeof(lists));
+    MEMSET(slot.lists_, 0, sizeof(slot.lists_));
+    MEMSET(slot.cnts_, 0, sizeof(slot.cnts_));
+    ATOMIC_STORE(&slot.lock_, 0);
+    for (int64_t j = 0; j < ARRAYSIZEOF(lists); j++) {
+      free_list(lists[j]);
+    }
+  }
+}
+
+void ObjectThreadCache::destroy()
+{
+  flush(true/*disable*/);
+  Slot *slots = ATOMIC_TAS(&slots_, nullptr);
+  if (OB_NOT_NULL(slots)) {
+    auto *ta = ObMallocAllocator::get_instance()->get_tenant_ctx_allocator(OB_SERVER_TENANT_ID, ObCtxIds::DEFAULT_CTX_ID);
+    if (OB_NOT_NULL(ta)) {
+      auto &root_mgr = static_cast<ObjectMgr&>(ta->get_block_mgr()).root_mgr_;
+      auto *obj = reinterpret_cast<AObject*>((char*)slots - AOBJECT_HEADER_SIZE);
+      abort_unless(obj->MAGIC_CODE_ == AOBJECT_MAGIC_CODE
+                   || obj->MAGIC_CODE_ == BIG_AOBJECT_MAGIC_CODE);
+      SANITY_POISON(obj->data_, obj->alloc_bytes_);
+      root_mgr.free_object(obj);
+    }
+  }
+}
+
+void ObjectThreadCache::free_list(AObject *list)
+{
+  // objects may come from different sub sets, each set is locked once
+  while (OB_NOT_NULL(list)) {
+    ObjectSet *set = list->block()->obj_set_;
+    AObject *batch = nullptr;
+    AObject *rest = nullptr;
+    while (OB_NOT_NULL(list)) {
+      AObject *next = list->next_;
+      AObject *&to = set == list->block()->obj_set_ ? batch : rest;
+      list->next_ = to;
+      to = list;
+      list = next;
+    }
+    set->free_objects(batch);
+    list = rest;
+  }
+}
+
 ObjectMgr::ObjectMgr(ObTenantCtxAllocator &allocator, uint64_t tenant_id, uint64_t ctx_id)
   : ta_(allocator), attr_(tenant_id, nullptr, ctx_id),
     sub_cnt_(1),
@@ -68,6 +230,11 @@ ObjectMgr::ObjectMgr(ObTenantCtxAllocator &allocator, uint64_t tenant_id, uint64
   root_mgr_.set_tenant_ctx_allocator(allocator, attr_);
   MEMSET(sub_mgrs_, 0, sizeof(sub_mgrs_));
   sub_mgrs_[0] = &root_mgr_;
+  if (common::ObCtxIds::LOGGER_CTX_ID == attr_.ctx_id_
+      || common::ObCtxIds::LIBEASY == attr_.ctx_id_) {
+    // their sets have special lockers, keep frees on the original path
+    tcache_.flush(true/*disable*/);
+  }
 }
 
 ObjectMgr::~ObjectMgr()
@@ -76,6 +243,8 @@ ObjectMgr::~ObjectMgr()
 }
 
 void ObjectMgr::reset() {
+  // cached objects belong to the sub sets destroyed below
+  tcache_.destroy();
   for (int i = 1; i < ATOMIC_LOAD(&sub_cnt_); i++) {
     if (sub_mgrs_[i] != nullptr) {
       destroy_sub_mgr(sub_mgrs_[i]);
@@ -90,6 +259,12 @@ AObject *ObjectMgr::alloc_object(uint64_t size, const ObMemAttr &attr)
   AObject *obj = NULL;
   const uint64_t start = common::get_itid();
   SubObjectMgr *sub_mgr = nullptr;
+  if (OB_LIKELY(size > 0 && size < UINT32_MAX)) {
+    const uint32_t cells = ObjectSet::get_cells(ObjectSet::get_all_size(size));
+    if (ObjectThreadCache::is_cacheable(cells)) {
+      obj = tcache_.alloc_object(cells, size, attr);
+    }
+  }
   for (uint64_t i = 0; NULL == obj && i < ATOMIC_LOAD(&sub_cnt_); i++) {
     uint64_t idx = (start + i) % sub_cnt_;
     sub_mgr = ATOMIC_LOAD(&sub_mgrs_[idx]);
@@ -159,10 +334,23 @@ void ObjectMgr::free_object(AObject *obj)
   abort_unless(block->obj_set_ != NULL);
 
   ObjectSet *set = block->obj_set_;
-  set->free_object(obj);
+  // objects of memory contexts may be freed here too, they never enter the cache
+  if (!is_own_set(set) || !tcache_.free_object(obj)) {
+    set->free_object(obj);
+  }
   // TODO by fengshuo.fs: when object_set is empty, try free the sub_mgr of it.
 }
 
+bool ObjectMgr::is_own_set(ObjectSet *set)
+{
+  bool own = false;
+  IBlockMgr *blk_mgr = set->get_block_mgr();
+  for (int i = 0; !own && i < ATOMIC_LOAD(&sub_cnt_); i++) {
+    own = blk_mgr == ATOMIC_LOAD(&sub_mgrs_[i]);
+  }
+  return own;
+}
+
 ABlock *ObjectMgr::alloc_block(uint64_t size, const ObMemAttr &attr)
 {
   ABlock *block = NULL;
@@ -251,6 +439,8 @@ void ObjectMgr::destroy_sub_mgr(SubObjectMgr *sub_mgr)
 int64_t ObjectMgr::sync_wash(int64_t wash_size)
 {
   int64_t washed_size = 0;
+  // cached objects pin their blocks
+  tcache_.flush(false/*disable*/);
   const uint64_t start = common::get_itid();
   for (uint64_t i = 0; washed_size < wash_size && i < ATOMIC_LOAD(&sub_cnt_); i++) {
     uint64_t idx = (start + i) % sub_cnt_;
@@ -76,6 +76,53 @@ private:
   ObjectSet os_;
 };
 
+// Front end of ObjectMgr for small objects. Objects freed by a thread are kept on
+// exact size class free lists of its slot and handed out again without touching
+// the ObjectSet owning them, so allocation heavy paths stop contending on the
+// locks of the shared sets. A list grown too long returns half of its objects to
+// their sets, one lock round trip per set.
+//
+// Cached objects are still in use from the view of their sets, so they stay
+// charged to the tenant, memory dumps show them under the label of the cache.
+// The cache is off until _enable_object_thread_cache turns it on.
+class ObjectThreadCache
+{
+public:
+  static const int SLOT_CNT = 16;
+  // cells of the biggest cached object, 512 bytes including the meta
+  static const uint32_t MAX_CACHE_CELLS = 64;
+  static const int MAX_CACHE_CNT = 64;
+  static constexpr const char *LABEL = "ObjThreadCache";
+private:
+  struct Slot
+  {
+    int64_t lock_;
+    uint16_t cnts_[MAX_CACHE_CELLS / 2 + 1];
+    AObject *lists_[MAX_CACHE_CELLS / 2 + 1];
+  };
+public:
+  ObjectThreadCache();
+  ~ObjectThreadCache() { destroy(); }
+  static void set_enabled(const bool enabled) { ATOMIC_STORE(&enabled_, enabled); }
+  static bool is_enabled() { return ATOMIC_LOAD(&enabled_); }
+  OB_INLINE static bool is_cacheable(const uint32_t cells) { return cells <= MAX_CACHE_CELLS; }
+  // returns NULL if the slot of the thread has no object of @cells cells
+  AObject *alloc_object(const uint32_t cells, const uint64_t size, const ObMemAttr &attr);
+  // returns false if @obj is not cached and must be freed to its set
+  bool free_object(AObject *obj);
+  // returns the cached objects to their sets, nothing is cached afterwards if @disable
+  void flush(const bool disable);
+  void destroy();
+private:
+  Slot *get_slot(const bool create);
+  static void free_list(AObject *list);
+private:
+  static bool enabled_;
+  bool disabled_;
+  Slot *slots_;
+  DISALLOW_COPY_AND_ASSIGN(ObjectThreadCache);
+};
+
 class ObjectMgr : public IBlockMgr
 {
   static const int N = 32;
@@ -108,7 +155,10 @@ public:
   void print_usage() const;
   int64_t sync_wash(int64_t wash_size) override;
   Stat get_stat();
+  void disable_thread_cache() { tcache_.flush(true/*disable*/); }
+  void flush_thread_cache() { tcache_.flush(false/*disable*/); }
 private:
+  bool is_own_set(ObjectSet *set);
   SubObjectMgr *create_sub_mgr();
   void destroy_sub_mgr(SubObjectMgr *sub_mgr);
 
@@ -120,6 +170,7 @@ public:
   SubObjectMgr *sub_mgrs_[N];
   int64_t last_wash_ts_;
   int64_t last_washed_size_;
+  ObjectThreadCache tcache_;
 }; // end of class ObjectMgr
 
 } // end of namespace lib
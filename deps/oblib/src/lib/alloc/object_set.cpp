@@ -34,6 +34,12 @@ void __attribute__((weak)) has_unfree_callback(char *info)
   _OB_LOG(ERROR, "HAS UNFREE PTR!!! %s", info);
 }
 
+// objects reused from ObjectThreadCache carry a size the set never saw
+static inline uint64_t accounted_bytes(const AObject *obj)
+{
+  return obj->from_tcache_ ? obj->set_bytes_ : obj->alloc_bytes_;
+}
+
 ObjectSet::ObjectSet(__MemoryContext__ *mem_context, const uint32_t ablock_size)
   : check_unfree_(false), mem_context_(mem_context), locker_(nullptr),
     blk_mgr_(nullptr), blist_(NULL), last_remainder_(NULL),
@@ -54,7 +60,7 @@ AObject *ObjectSet::alloc_object(
     const uint64_t size, const ObMemAttr &attr)
 {
   const uint64_t adj_size = MAX(size, MIN_AOBJECT_SIZE);
-  const uint64_t all_size = align_up2(adj_size + AOBJECT_META_SIZE, 16);
+  const uint64_t all_size = get_all_size(size);
 
   const int64_t ctx_id = blk_mgr_->get_tenant_ctx_allocator().get_ctx_id();
   abort_unless(ctx_id == attr.ctx_id_);
@@ -69,7 +75,7 @@ AObject *ObjectSet::alloc_object(
     afc.reason_ = SINGLE_ALLOC_SIZE_OVERFLOW;
     afc.alloc_size_ = size;
   } else if (all_size <= ablock_size_) {
-    const uint32_t cls = (uint32_t)(1+ ((all_size - 1) / AOBJECT_CELL_BYTES));
+    const uint32_t cls = get_cells(all_size);
     obj = alloc_normal_object(cls, attr);
     if (NULL != obj) {
       normal_alloc_bytes_ += size;
@@ -86,6 +92,7 @@ AObject *ObjectSet::alloc_object(
 
     reinterpret_cast<uint64_t&>(obj->data_[size]) = AOBJECT_TAIL_MAGIC_CODE;
     obj->alloc_bytes_ = static_cast<uint32_t>(size);
+    obj->from_tcache_ = false;
 
     if (attr.label_.str_ != nullptr) {
       STRNCPY(&obj->label_[0], attr.label_.str_, sizeof(obj->label_));
@@ -275,7 +282,7 @@ void ObjectSet::free_normal_object(AObject *obj)
   abort_unless(NULL != obj);
   abort_unless(obj->is_valid());
 
-  normal_alloc_bytes_ -= obj->alloc_bytes_;
+  normal_alloc_bytes_ -= accounted_bytes(obj);
   normal_used_bytes_ -= obj->nobjs_ * AOBJECT_CELL_BYTES;
 
   AObject *newobj = merge_obj(obj);
@@ -408,12 +415,26 @@ void ObjectSet::free_object(AObject *obj)
   }
 }
 
+void ObjectSet::free_objects(AObject *list)
+{
+  locker_->lock();
+  while (OB_NOT_NULL(list)) {
+    AObject *next = list->next_;
+    abort_unless(list->is_valid());
+    abort_unless(list->in_use_);
+    abort_unless(this == list->block()->obj_set_);
+    do_free_object(list);
+    list = next;
+  }
+  locker_->unlock();
+}
+
 void ObjectSet::do_free_object(AObject *obj)
 {
   const int64_t hold = obj->hold(cells_per_block_);
   const int64_t used = obj->alloc_bytes_;
 
-  alloc_bytes_ -= obj->alloc_bytes_;
+  alloc_bytes_ -= accounted_bytes(obj);
   used_bytes_ -= hold;
 
   obj->in_use_ = false;
@@ -468,7 +489,12 @@ void ObjectSet::do_free_dirty_list()
 
 void ObjectSet::reset()
 {
-  if (check_unfree_ && blist_ != nullptr) {
+  // Every live object is counted in alloc_bytes_ (zero-sized objects are rejected) and
+  // pending frees sit in dirty_list_, so the walk over all blocks is only needed when
+  // one of them says something is still around. Request-scoped contexts are destroyed
+  // clean on every statement and skip it.
+  const bool maybe_unfree = 0 != alloc_bytes_ || nullptr != dirty_list_;
+  if (check_unfree_ && blist_ != nullptr && maybe_unfree) {
     const bool context_check = mem_context_ != nullptr;
     ABlock *free_list_block = nullptr;
     if (free_lists_ != nullptr) {
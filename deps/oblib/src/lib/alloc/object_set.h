@@ -51,9 +51,21 @@ public:
   // main interfaces
   AObject *alloc_object(const uint64_t size, const ObMemAttr &attr);
   void free_object(AObject *obj);
+  // frees a list linked by next_ of objects of this set under one lock
+  void free_objects(AObject *list);
   AObject *realloc_object(AObject *obj, const uint64_t size, const ObMemAttr &attr);
   void reset();
 
+  // size of an object of @size including the meta, and the cells it takes
+  OB_INLINE static uint64_t get_all_size(const uint64_t size)
+  {
+    return align_up2(MAX(size, MIN_AOBJECT_SIZE) + AOBJECT_META_SIZE, 16);
+  }
+  OB_INLINE static uint32_t get_cells(const uint64_t all_size)
+  {
+    return (uint32_t)(1 + ((all_size - 1) / AOBJECT_CELL_BYTES));
+  }
+
   // statistics
   uint64_t get_alloc_bytes() const;
   uint64_t get_hold_bytes() const;
@@ -14,6 +14,7 @@
 #include "lib/alloc/alloc_failed_reason.h"
 #include "lib/alloc/memory_sanity.h"
 #include "lib/allocator/ob_mem_leak_checker.h"
+#include "lib/allocator/ob_mem_sample_profiler.h"
 
 using namespace oceanbase::lib;
 namespace oceanbase
@@ -44,6 +45,7 @@ void *ObAllocator::alloc(const int64_t size, const ObMemAttr &attr)
     if (NULL != obj) {
       ptr = obj->data_;
       get_mem_leak_checker().on_alloc(*obj, inner_attr);
+      ObMemSampleProfiler::get_instance().on_alloc(*obj, inner_attr);
       SANITY_POISON(obj, AOBJECT_HEADER_SIZE);
       SANITY_UNPOISON(obj->data_, obj->alloc_bytes_);
       SANITY_POISON((void*)upper_align((int64_t)obj->data_ + obj->alloc_bytes_, 8), sizeof(AOBJECT_TAIL_MAGIC_CODE));
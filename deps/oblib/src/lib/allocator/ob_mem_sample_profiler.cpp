@@ -0,0 +1,222 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX LIB
+
+#include "lib/allocator/ob_mem_sample_profiler.h"
+#include <execinfo.h>
+#include <math.h>
+#include "lib/allocator/ob_malloc.h"
+#include "lib/hash_func/murmur_hash.h"
+#include "lib/time/ob_time_utility.h"
+
+using namespace oceanbase::lib;
+namespace oceanbase
+{
+namespace common
+{
+__thread int64_t ObMemSampleProfiler::bytes_until_sample_ = 0;
+__thread bool ObMemSampleProfiler::distance_inited_ = false;
+__thread uint64_t ObMemSampleProfiler::rand_state_ = 0;
+__thread bool ObMemSampleProfiler::in_sample_ = false;
+
+ObMemSampleProfiler::ObMemSampleProfiler()
+  : lock_(), interval_(0), used_cnt_(0), dropped_cnt_(0)
+{
+  MEMSET(buckets_, 0, sizeof(buckets_));
+}
+
+ObMemSampleProfiler &ObMemSampleProfiler::get_instance()
+{
+  static ObMemSampleProfiler instance;
+  return instance;
+}
+
+void ObMemSampleProfiler::set_interval(const int64_t interval)
+{
+  const int64_t new_interval = interval > 0 ? interval : 0;
+  const int64_t old_interval = ATOMIC_LOAD(&interval_);
+  if (new_interval != old_interval) {
+    // samples taken with different intervals can not be unsampled together
+    reset();
+    ATOMIC_STORE(&interval_, new_interval);
+    _OB_LOG(INFO, "memory sample interval changed, %ld => %ld", old_interval, new_interval);
+  }
+}
+
+void ObMemSampleProfiler::reset()
+{
+  ObSpinLockGuard guard(lock_);
+  MEMSET(buckets_, 0, sizeof(buckets_));
+  used_cnt_ = 0;
+  dropped_cnt_ = 0;
+}
+
+int64_t ObMemSampleProfiler::next_sample_distance(const int64_t interval)
+{
+  if (OB_UNLIKELY(0 == rand_state_)) {
+    rand_state_ = reinterpret_cast<uint64_t>(&rand_state_) ^ ObTimeUtility::current_time() ^ 1;
+  }
+  // xorshift64*, the upper 53 bits give a uniform double in (0, 1]
+  rand_state_ ^= rand_state_ >> 12;
+  rand_state_ ^= rand_state_ << 25;
+  rand_state_ ^= rand_state_ >> 27;
+  const uint64_t r = rand_state_ * 2685821657736338717ULL;
+  const double u = (static_cast<double>(r >> 11) + 1.0) / 9007199254740992.0;
+  return static_cast<int64_t>(-log(u) * static_cast<double>(interval)) + 1;
+}
+
+void ObMemSampleProfiler::sample(const AObject &obj, const ObMemAttr &attr, const int64_t interval)
+{
+  bytes_until_sample_ = next_sample_distance(interval);
+  if (OB_UNLIKELY(!distance_inited_)) {
+    // the countdown of this thread has not been drawn yet, sampling now would
+    // sample the first allocation of every thread
+    distance_inited_ = true;
+  } else if (!in_sample_) {
+    // backtrace may allocate when it is called the first time in a thread
+    in_sample_ = true;
+    void *stack[MAX_STACK_DEPTH + 2];
+    // skip the frames of the profiler itself
+    const int64_t skip = 2;
+    const int64_t depth = MAX(0, backtrace(stack, MAX_STACK_DEPTH + skip) - skip);
+    const int64_t bytes = obj.alloc_bytes_;
+    uint64_t hash = murmurhash(&attr.tenant_id_, sizeof(attr.tenant_id_), 0);
+    hash = murmurhash(obj.label_, static_cast<int32_t>(STRLEN(obj.label_)), hash);
+    hash = murmurhash(stack + skip, static_cast<int32_t>(depth * sizeof(void *)), hash);
+    // unsample: an allocation of @bytes is sampled with probability 1 - e^(-bytes/interval)
+    const double prob = 1.0 - exp(-static_cast<double>(bytes) / static_cast<double>(interval));
+    const double scale = prob > 0 ? 1.0 / prob : 1.0;
+    ObSpinLockGuard guard(lock_);
+    bool found = false;
+    for (int64_t i = 0, pos = hash % BUCKET_COUNT; !found && i < BUCKET_COUNT;
+         ++i, pos = (pos + 1) % BUCKET_COUNT) {
+      Bucket &bucket = buckets_[pos];
+      if (0 == bucket.count_) {
+        if (used_cnt_ * 4 >= BUCKET_COUNT * 3) {
+          // keep probe sequences short, samples of new origins are dropped once the table is full
+          break;
+        }
+        bucket.hash_ = hash;
+        bucket.tenant_id_ = attr.tenant_id_;
+        STRNCPY(bucket.label_, obj.label_, sizeof(bucket.label_) - 1);
+        bucket.label_[sizeof(bucket.label_) - 1] = '\0';
+        bucket.depth_ = depth;
+        MEMCPY(bucket.stack_, stack + skip, depth * sizeof(void *));
+        ++used_cnt_;
+        found = true;
+      } else if (bucket.hash_ == hash
+                 && bucket.tenant_id_ == attr.tenant_id_
+                 && bucket.depth_ == depth
+                 && 0 == STRNCMP(bucket.label_, obj.label_, sizeof(bucket.label_) - 1)
+                 && 0 == MEMCMP(bucket.stack_, stack + skip, depth * sizeof(void *))) {
+        found = true;
+      }
+      if (found) {
+        bucket.count_ += 1;
+        bucket.bytes_ += bytes;
+        bucket.est_count_ += scale;
+        bucket.est_bytes_ += static_cast<double>(bytes) * scale;
+      }
+    }
+    if (!found) {
+      ++dropped_cnt_;
+    }
+    in_sample_ = false;
+  }
+}
+
+int ObMemSampleProfiler::snapshot(Bucket *buckets, int64_t &count, int64_t &interval) const
+{
+  int ret = OB_SUCCESS;
+  count = 0;
+  if (OB_ISNULL(buckets)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), KP(buckets));
+  } else {
+    int64_t dropped_cnt = 0;
+    {
+      // nothing under the lock may allocate, it would sample into the table again
+      ObSpinLockGuard guard(lock_);
+      interval = interval_;
+      dropped_cnt = dropped_cnt_;
+      for (int64_t i = 0; i < BUCKET_COUNT; ++i) {
+        if (buckets_[i].count_ > 0) {
+          buckets[count++] = buckets_[i];
+        }
+      }
+    }
+    if (dropped_cnt > 0) {
+      LOG_INFO("memory sample table is full, samples dropped", K(count), K(dropped_cnt));
+    }
+  }
+  return ret;
+}
+
+int ObMemSampleProfiler::dump_pprof(const char *file_name) const
+{
+  int ret = OB_SUCCESS;
+  Bucket *buckets = nullptr;
+  int64_t count = 0;
+  int64_t interval = 0;
+  FILE *file = nullptr;
+  if (OB_ISNULL(file_name)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret));
+  } else if (OB_ISNULL(buckets = static_cast<Bucket *>(ob_malloc(sizeof(Bucket) * BUCKET_COUNT,
+                                                                  ObMemAttr(OB_SERVER_TENANT_ID, "MemSampleProf"))))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("alloc memory failed", K(ret));
+  } else if (OB_FAIL(snapshot(buckets, count, interval))) {
+    LOG_WARN("snapshot failed", K(ret));
+  } else if (OB_ISNULL(file = fopen(file_name, "w"))) {
+    ret = OB_IO_ERROR;
+    LOG_WARN("open file failed", K(ret), K(file_name), K(errno));
+  } else {
+    // frees are not tracked, so the in-use and the allocated columns are both
+    // the cumulative samples; pprof unsamples the raw values by itself
+    int64_t total_count = 0;
+    int64_t total_bytes = 0;
+    for (int64_t i = 0; i < count; ++i) {
+      total_count += buckets[i].count_;
+      total_bytes += buckets[i].bytes_;
+    }
+    fprintf(file, "heap profile: %ld: %ld [%ld: %ld] @ heap_v2/%ld\n",
+            total_count, total_bytes, total_count, total_bytes, interval);
+    for (int64_t i = 0; i < count; ++i) {
+      const Bucket &bucket = buckets[i];
+      fprintf(file, "%ld: %ld [%ld: %ld] @", bucket.count_, bucket.bytes_, bucket.count_, bucket.bytes_);
+      for (int64_t j = 0; j < bucket.depth_; ++j) {
+        fprintf(file, " %p", bucket.stack_[j]);
+      }
+      fprintf(file, "\n");
+    }
+    fprintf(file, "\nMAPPED_LIBRARIES:\n");
+    FILE *maps = fopen("/proc/self/maps", "r");
+    if (OB_NOT_NULL(maps)) {
+      char line[1024];
+      while (nullptr != fgets(line, sizeof(line), maps)) {
+        fputs(line, file);
+      }
+      fclose(maps);
+    }
+    fclose(file);
+    LOG_INFO("dump memory samples", K(file_name), K(count), K(interval));
+  }
+  if (OB_NOT_NULL(buckets)) {
+    ob_free(buckets);
+  }
+  return ret;
+}
+
+} // end of namespace common
+} // end of namespace oceanbase
@@ -0,0 +1,94 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_ALLOCATOR_OB_MEM_SAMPLE_PROFILER_H_
+#define OCEANBASE_ALLOCATOR_OB_MEM_SAMPLE_PROFILER_H_
+
+#include "lib/alloc/alloc_struct.h"
+#include "lib/lock/ob_spin_lock.h"
+
+namespace oceanbase
+{
+namespace common
+{
+// Sampling allocation profiler, unlike ObMemLeakChecker it is cheap enough to
+// stay on for all labels. Every thread counts down the bytes it allocates and
+// takes a sample when the countdown expires, the distance to the next sample
+// is drawn from an exponential distribution with mean interval_, so an
+// allocation is sampled with a probability proportional to its size.
+//
+// A sample records a short stack with the tenant and label of the allocation,
+// samples of the same origin are aggregated into one bucket. The buckets are
+// exposed through __all_virtual_mem_leak_checker_info and dumped in the pprof
+// heap format together with the leak checker.
+class ObMemSampleProfiler
+{
+public:
+  static const int64_t MAX_STACK_DEPTH = 16;
+  static const int64_t BUCKET_COUNT = 4096;
+  struct Bucket
+  {
+    uint64_t hash_;
+    uint64_t tenant_id_;
+    char label_[lib::AOBJECT_LABEL_SIZE + 1];
+    int64_t depth_;
+    void *stack_[MAX_STACK_DEPTH];
+    // sampled allocations
+    int64_t count_;
+    int64_t bytes_;
+    // allocations they stand for, scaled by the sampling probability, kept
+    // fractional so that small allocations are not underestimated
+    double est_count_;
+    double est_bytes_;
+    int64_t get_est_count() const { return static_cast<int64_t>(est_count_ + 0.5); }
+    int64_t get_est_bytes() const { return static_cast<int64_t>(est_bytes_ + 0.5); }
+  };
+public:
+  static ObMemSampleProfiler &get_instance();
+  // @interval: average bytes allocated between two samples, 0 disables sampling
+  void set_interval(const int64_t interval);
+  int64_t get_interval() const { return ATOMIC_LOAD(&interval_); }
+  void reset();
+  OB_INLINE void on_alloc(const lib::AObject &obj, const lib::ObMemAttr &attr)
+  {
+    const int64_t interval = ATOMIC_LOAD(&interval_);
+    if (OB_UNLIKELY(interval > 0)
+        && OB_UNLIKELY((bytes_until_sample_ -= obj.alloc_bytes_) < 0)) {
+      sample(obj, attr, interval);
+    }
+  }
+  // copies the buckets in use, @buckets must hold BUCKET_COUNT buckets
+  int snapshot(Bucket *buckets, int64_t &count, int64_t &interval) const;
+  // dumps the samples in the legacy heap profile format understood by pprof
+  int dump_pprof(const char *file_name) const;
+private:
+  ObMemSampleProfiler();
+  void sample(const lib::AObject &obj, const lib::ObMemAttr &attr, const int64_t interval);
+  int64_t next_sample_distance(const int64_t interval);
+private:
+  mutable ObSpinLock lock_;
+  int64_t interval_;
+  int64_t used_cnt_;
+  int64_t dropped_cnt_;
+  Bucket buckets_[BUCKET_COUNT];
+  static __thread int64_t bytes_until_sample_;
+  // a new thread starts with an expired countdown, its first allocation only draws the distance
+  static __thread bool distance_inited_;
+  static __thread uint64_t rand_state_;
+  static __thread bool in_sample_;
+  DISALLOW_COPY_AND_ASSIGN(ObMemSampleProfiler);
+};
+
+} // end of namespace common
+} // end of namespace oceanbase
+
+#endif // OCEANBASE_ALLOCATOR_OB_MEM_SAMPLE_PROFILER_H_
@@ -10,12 +10,18 @@
  * See the Mulan PubL v2 for more details.
  */
 
+#define USING_LOG_PREFIX LIB
+
 #include "lib/cpu/ob_cpu_topology.h"
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
+#include <unistd.h>
 #include <pthread.h>
+#include <sys/syscall.h>
 #include "lib/ob_define.h"
+#include "lib/oblog/ob_log.h"
 
 using namespace oceanbase::common;
 
@@ -26,6 +32,168 @@ int64_t __attribute__((weak)) get_cpu_count()
 {
   return get_cpu_num();
 }
+
+// mempolicy modes of set_mempolicy(2), numaif.h is not always installed
+static const int OB_MPOL_DEFAULT = 0;
+static const int OB_MPOL_PREFERRED = 1;
+
+static __thread int64_t tl_numa_node = -1;
+// the node last asked for, a node that failed to bind is not tried again until
+// the thread is asked for another one
+static __thread int64_t tl_target_numa_node = -1;
+
+static int parse_cpu_list(const char *buf, cpu_set_t &cpu_set)
+{
+  int ret = OB_SUCCESS;
+  const char *pos = buf;
+  CPU_ZERO(&cpu_set);
+  while (OB_SUCC(ret) && '\0' != *pos && '\n' != *pos) {
+    char *end = nullptr;
+    int64_t first = strtol(pos, &end, 10);
+    int64_t last = first;
+    if (end == pos) {
+      ret = OB_INVALID_DATA;
+    } else if ('-' == *end) {
+      pos = end + 1;
+      last = strtol(pos, &end, 10);
+      if (end == pos) {
+        ret = OB_INVALID_DATA;
+      }
+    }
+    for (int64_t cpu = first; OB_SUCC(ret) && cpu <= last && cpu < CPU_SETSIZE; ++cpu) {
+      CPU_SET(cpu, &cpu_set);
+    }
+    if (OB_SUCC(ret)) {
+      pos = (',' == *end) ? end + 1 : end;
+    }
+  }
+  return ret;
+}
+
+static int get_numa_node_cpus(const int64_t numa_node, cpu_set_t &cpu_set)
+{
+  int ret = OB_SUCCESS;
+  char path[64];
+  char buf[1024];
+  FILE *file = nullptr;
+  snprintf(path, sizeof(path), "/sys/devices/system/node/node%ld/cpulist", numa_node);
+  if (OB_ISNULL(file = fopen(path, "r"))) {
+    ret = OB_ENTRY_NOT_EXIST;
+  } else {
+    if (OB_ISNULL(fgets(buf, sizeof(buf), file))) {
+      ret = OB_IO_ERROR;
+    } else if (OB_FAIL(parse_cpu_list(buf, cpu_set))) {
+      LOG_WARN("invalid numa node cpu list", K(ret), K(numa_node));
+    } else if (0 == CPU_COUNT(&cpu_set)) {
+      ret = OB_ENTRY_NOT_EXIST;
+    }
+    fclose(file);
+  }
+  return ret;
+}
+
+int64_t get_numa_node_count()
+{
+  static int64_t numa_node_count = -1;
+  if (OB_UNLIKELY(numa_node_count < 0)) {
+    int64_t cnt = 0;
+    char path[64];
+    for (; cnt < OB_MAX_NUMA_NODE_COUNT; ++cnt) {
+      snprintf(path, sizeof(path), "/sys/devices/system/node/node%ld", cnt);
+      if (0 != access(path, F_OK)) {
+        break;
+      }
+    }
+    ATOMIC_STORE(&numa_node_count, cnt);
+  }
+  return numa_node_count;
+}
+
+// cpus of the process before any thread was bound, restored on unbind
+struct ObProcessCpuSet
+{
+  ObProcessCpuSet()
+  {
+    if (0 != sched_getaffinity(getpid(), sizeof(cpu_set_), &cpu_set_)) {
+      CPU_ZERO(&cpu_set_);
+      for (int64_t cpu = 0; cpu < get_cpu_num() && cpu < CPU_SETSIZE; ++cpu) {
+        CPU_SET(cpu, &cpu_set_);
+      }
+    }
+  }
+  cpu_set_t cpu_set_;
+};
+
+static const cpu_set_t &get_process_cpu_set()
+{
+  static const ObProcessCpuSet process_cpu_set;
+  return process_cpu_set.cpu_set_;
+}
+
+// cpus of numa_node the process may run on, a cpuset or cgroup may exclude some or all
+static int get_usable_numa_node_cpus(const int64_t numa_node, cpu_set_t &cpu_set)
+{
+  int ret = OB_SUCCESS;
+  cpu_set_t process_cpu_set = get_process_cpu_set();
+  if (OB_FAIL(get_numa_node_cpus(numa_node, cpu_set))) {
+    // do nothing
+  } else {
+    CPU_AND(&cpu_set, &cpu_set, &process_cpu_set);
+    if (0 == CPU_COUNT(&cpu_set)) {
+      ret = OB_ENTRY_NOT_EXIST;
+    }
+  }
+  return ret;
+}
+
+bool is_numa_node_bindable(const int64_t numa_node)
+{
+  cpu_set_t cpu_set;
+  return numa_node >= 0
+      && numa_node < get_numa_node_count()
+      && OB_SUCCESS == get_usable_numa_node_cpus(numa_node, cpu_set);
+}
+
+int bind_thread_to_numa_node(const int64_t numa_node)
+{
+  int ret = OB_SUCCESS;
+  const int64_t node = numa_node < 0 ? -1 : numa_node;
+  cpu_set_t cpu_set = get_process_cpu_set();
+  unsigned long node_mask = 0;
+  if (node == tl_numa_node || node == tl_target_numa_node) {
+    // already bound, or the bind failed and is not retried
+    tl_target_numa_node = node;
+  } else if (FALSE_IT(tl_target_numa_node = node)) {
+  } else if (node >= get_numa_node_count()) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("numa node not exist", K(ret), K(node), "numa_node_count", get_numa_node_count());
+  } else if (node >= 0 && OB_FAIL(get_usable_numa_node_cpus(node, cpu_set))) {
+    LOG_WARN("fail to get usable numa node cpus", K(ret), K(node));
+  } else {
+    int err = 0;
+    if (node >= 0) {
+      node_mask = 1UL << node;
+    }
+    if (0 != (err = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set))) {
+      ret = OB_ERR_SYS;
+      LOG_WARN("fail to set thread affinity", K(ret), K(err), K(node));
+    } else {
+      tl_numa_node = node;
+      if (0 != (node >= 0
+                ? syscall(SYS_set_mempolicy, OB_MPOL_PREFERRED, &node_mask, OB_MAX_NUMA_NODE_COUNT + 1)
+                : syscall(SYS_set_mempolicy, OB_MPOL_DEFAULT, nullptr, 0))) {
+        // the thread still runs on the node, its memory keeps the default policy
+        LOG_WARN("fail to set thread memory policy", K(errno), K(node));
+      }
+    }
+  }
+  return ret;
+}
+
+int64_t get_thread_numa_node()
+{
+  return tl_numa_node;
+}
+
 } // common
 } // oceanbase
-
@@ -22,6 +22,19 @@ namespace oceanbase
 namespace common
 {
 int64_t get_cpu_count();
+
+// NUMA nodes beyond this are treated as not present
+static const int64_t OB_MAX_NUMA_NODE_COUNT = 8;
+int64_t get_numa_node_count();
+// whether numa_node exists and has cpus the process may run on
+bool is_numa_node_bindable(const int64_t numa_node);
+// Pin the calling thread to the cpus of numa_node and prefer its local memory for
+// the pages the thread faults in, a negative numa_node restores the process cpus
+// and the default memory policy. A node that failed to bind is not tried again by
+// the thread until it is asked for another node.
+int bind_thread_to_numa_node(const int64_t numa_node);
+// the node the calling thread is bound to, -1 if not bound
+int64_t get_thread_numa_node();
 } // namespace common
 } // namespace oceanbase
 
@@ -18,7 +18,8 @@ namespace lib
 
 ObLibConfig::ObLibConfig()
   : enable_diagnose_info_(true),
-    enable_trace_log_(true)
+    enable_trace_log_(true),
+    wait_event_sample_interval_(1)
 {
 }
 
@@ -38,5 +39,10 @@ void ObLibConfig::reload_trace_log_config(const bool enable_trace_log)
   ATOMIC_SET(&enable_trace_log_, enable_trace_log);
 }
 
+void ObLibConfig::reload_wait_event_sample_config(const int64_t sample_interval)
+{
+  ATOMIC_SET(&wait_event_sample_interval_, sample_interval > 0 ? sample_interval : 1);
+}
+
 } //lib
 } //oceanbase
@@ -26,6 +26,7 @@ public:
   static ObLibConfig &get_instance();
   void reload_diagnose_info_config(const bool enable_diagnose_info);
   void reload_trace_log_config(const bool enable_trace_log);
+  void reload_wait_event_sample_config(const int64_t sample_interval);
   bool is_diagnose_info_enabled() const
   {
     return enable_diagnose_info_;
@@ -34,11 +35,16 @@ public:
   {
     return enable_trace_log_;
   }
+  int64_t get_wait_event_sample_interval() const
+  {
+    return wait_event_sample_interval_;
+  }
 private:
   ObLibConfig();
   virtual ~ObLibConfig() = default;
   volatile bool enable_diagnose_info_ CACHE_ALIGNED;
   volatile bool enable_trace_log_ CACHE_ALIGNED;
+  volatile int64_t wait_event_sample_interval_ CACHE_ALIGNED;
 };
 
 inline bool is_diagnose_info_enabled()
@@ -65,6 +71,18 @@ inline int reload_trace_log_config(const bool enable_trace_log)
   return ret;
 }
 
+inline int64_t get_wait_event_sample_interval()
+{
+  return ObLibConfig::get_instance().get_wait_event_sample_interval();
+}
+
+inline int reload_wait_event_sample_config(const int64_t sample_interval)
+{
+  int ret = common::OB_SUCCESS;
+  ObLibConfig::get_instance().reload_wait_event_sample_config(sample_interval);
+  return ret;
+}
+
 } //lib
 } //oceanbase
 #endif // OB_LIB_CONFIG_H_
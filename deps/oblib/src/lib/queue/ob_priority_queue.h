@@ -107,7 +107,7 @@ class ObPriorityQueue2
 public:
   enum { PRIO_CNT = HIGH_HIGH_PRIOS + HIGH_PRIOS + LOW_PRIOS };
 
-  ObPriorityQueue2() : queue_(), size_(0), limit_(INT64_MAX) {}
+  ObPriorityQueue2() : queue_(), size_(0), limit_(INT64_MAX), n_waiters_(0) {}
   ~ObPriorityQueue2() {}
 
   void set_limit(int64_t limit) { limit_ = limit; }
@@ -136,6 +136,9 @@ public:
       COMMON_LOG(WARN, "push error, invalid argument", KP(data), K(priority));
     } else if (OB_FAIL(queue_[priority].push(data))) {
       // do nothing
+    } else if (0 == ATOMIC_LOAD(&n_waiters_)) {
+      // every popper is busy and will see the task before going to sleep, skip the
+      // wakeup which would otherwise touch the conds of all cpus
     } else {
       if (priority < HIGH_HIGH_PRIOS) {
         cond_.signal(1, 0);
@@ -188,7 +191,13 @@ private:
         }
       }
       if (OB_FAIL(ret)) {
-        cond_.wait(timeout_us);
+        // Pairs with the waiter check in push: either the pusher sees us waiting
+        // or we see its task here, so the wakeup can not be lost.
+        ATOMIC_INC(&n_waiters_);
+        if (!has_task(plimit)) {
+          cond_.wait(timeout_us);
+        }
+        ATOMIC_DEC(&n_waiters_);
         data = NULL;
       } else {
         (void)ATOMIC_FAA(&size_, -1);
@@ -197,10 +206,20 @@ private:
     return ret;
   }
 
+  inline bool has_task(int64_t plimit) const
+  {
+    bool bret = false;
+    for (int i = 0; !bret && i < plimit; i++) {
+      bret = queue_[i].size() > 0;
+    }
+    return bret;
+  }
+
   SCondTemp<3> cond_;
   ObLinkQueue queue_[PRIO_CNT];
   int64_t size_ CACHE_ALIGNED;
   int64_t limit_ CACHE_ALIGNED;
+  int64_t n_waiters_ CACHE_ALIGNED;
   DISALLOW_COPY_AND_ASSIGN(ObPriorityQueue2);
 };
 } // end namespace common
@@ -59,9 +59,14 @@ AChunkMgr &AChunkMgr::instance()
 }
 
 AChunkMgr::AChunkMgr()
-  : free_list_(), chunk_bitmap_(nullptr), limit_(DEFAULT_LIMIT), urgent_(0), hold_(0),
+  : free_list_(), chunk_bitmap_(nullptr),
+    max_chunk_cache_cnt_(AChunkList::DEFAULT_MAX_CHUNK_CACHE_CNT),
+    limit_(DEFAULT_LIMIT), urgent_(0), hold_(0),
     total_hold_(0), maps_(0), unmaps_(0), large_maps_(0), large_unmaps_(0)
 {
+#ifdef OB_USE_ASAN
+  max_chunk_cache_cnt_ = 0;
+#endif
 }
 
 void *AChunkMgr::direct_alloc(const uint64_t size, const bool can_use_huge_page, bool &huge_page_used, const bool alloc_shadow)
@@ -194,6 +199,28 @@ void AChunkMgr::low_free(const void *ptr, const uint64_t size)
   ::munmap((void*)ptr, size);
 }
 
+AChunk *AChunkMgr::pop_local_free_chunk()
+{
+  AChunk *chunk = nullptr;
+  AChunkList &free_list = free_list_of(common::get_thread_numa_node() + 1);
+  if (free_list.count() > 0) {
+    chunk = free_list.pop();
+  }
+  return chunk;
+}
+
+AChunk *AChunkMgr::pop_any_free_chunk()
+{
+  AChunk *chunk = nullptr;
+  for (int64_t slot = 0; OB_ISNULL(chunk) && slot <= common::OB_MAX_NUMA_NODE_COUNT; ++slot) {
+    AChunkList &free_list = free_list_of(slot);
+    if (free_list.count() > 0) {
+      chunk = free_list.pop();
+    }
+  }
+  return chunk;
+}
+
 AChunk *AChunkMgr::alloc_chunk(const uint64_t size, bool high_prio)
 {
   const int64_t hold_size = hold(size);
@@ -205,9 +232,7 @@ AChunk *AChunkMgr::alloc_chunk(const uint64_t size, bool high_prio)
   if (achunk_size == hold_size) {
     // TODO by fengshuo.fs: chunk cached by freelist may not use all memory in it,
     //                      so update_hold can use hold_size too.
-    if (free_list_.count() > 0) {
-      chunk = free_list_.pop();
-    }
+    chunk = pop_local_free_chunk();
     if (OB_ISNULL(chunk)) {
       if (update_hold(hold_size, high_prio)) {
         bool hugetlb_used = false;
@@ -215,17 +240,21 @@ AChunk *AChunkMgr::alloc_chunk(const uint64_t size, bool high_prio)
         if (ptr != nullptr) {
           chunk = new (ptr) AChunk();
           chunk->is_hugetlb_ = hugetlb_used;
+          chunk->numa_slot_ = static_cast<uint8_t>(common::get_thread_numa_node() + 1);
         } else {
           IGNORE_RETURN update_hold(-hold_size, high_prio);
         }
+      } else if (OB_NOT_NULL(chunk = pop_any_free_chunk())) {
+        // a chunk cached by another numa node is better than failing at the limit
+        is_allocated = false;
       }
     } else {
       is_allocated = false;
     }
   } else {
     bool updated = false;
-    while (!(updated = update_hold(hold_size, high_prio)) && free_list_.count() > 0) {
-      if (OB_NOT_NULL(chunk = free_list_.pop())) {
+    while (!(updated = update_hold(hold_size, high_prio)) && get_free_chunk_count() > 0) {
+      if (OB_NOT_NULL(chunk = pop_any_free_chunk())) {
         direct_free(chunk, achunk_size);
         IGNORE_RETURN update_hold(-achunk_size, high_prio);
         IGNORE_RETURN ATOMIC_FAA(&total_hold_, -achunk_size);
@@ -238,6 +267,7 @@ AChunk *AChunkMgr::alloc_chunk(const uint64_t size, bool high_prio)
       if (ptr != nullptr) {
         chunk = new (ptr) AChunk();
         chunk->is_hugetlb_ = hugetlb_used;
+        chunk->numa_slot_ = static_cast<uint8_t>(common::get_thread_numa_node() + 1);
       } else {
         IGNORE_RETURN update_hold(-hold_size, high_prio);
       }
@@ -266,8 +296,10 @@ void AChunkMgr::free_chunk(AChunk *chunk)
     const int64_t achunk_size = INTACT_ACHUNK_SIZE;
     bool freed = true;
     if (achunk_size == hold_size) {
-      if (hold_ + hold_size <= limit_) {
-        freed = !free_list_.push(chunk);
+      // each list only bounds itself, the cache limit applies to the lists of all
+      // numa nodes together
+      if (hold_ + hold_size <= limit_ && get_free_chunk_count() < max_chunk_cache_cnt_) {
+        freed = !free_list_of(chunk->numa_slot_).push(chunk);
       }
       if (freed) {
         direct_free(chunk, all_size);
@@ -292,8 +324,8 @@ AChunk *AChunkMgr::alloc_co_chunk(const uint64_t size)
 
   AChunk *chunk = nullptr;
   bool updated = false;
-  while (!(updated = update_hold(hold_size, true)) && free_list_.count() > 0) {
-    if (OB_NOT_NULL(chunk = free_list_.pop())) {
+  while (!(updated = update_hold(hold_size, true)) && get_free_chunk_count() > 0) {
+    if (OB_NOT_NULL(chunk = pop_any_free_chunk())) {
       direct_free(chunk, achunk_size);
       IGNORE_RETURN update_hold(-achunk_size, true);
       IGNORE_RETURN ATOMIC_FAA(&total_hold_, -achunk_size);
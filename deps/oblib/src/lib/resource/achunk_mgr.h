@@ -22,6 +22,7 @@
 #include "lib/atomic/ob_atomic.h"
 #include "lib/ob_define.h"
 #include "lib/lock/ob_mutex.h"
+#include "lib/cpu/ob_cpu_topology.h"
 
 namespace oceanbase
 {
@@ -183,8 +184,19 @@ public:
   void free_co_chunk(AChunk *chunk);
   static OB_INLINE uint64_t aligned(const uint64_t size);
   static OB_INLINE uint64_t hold(const uint64_t size);
+  // cnt bounds the chunks cached by all numa nodes together, see free_chunk()
   void set_max_chunk_cache_cnt(const int cnt)
-  { free_list_.set_max_chunk_cache_cnt(cnt); }
+  {
+#ifdef OB_USE_ASAN
+    max_chunk_cache_cnt_ = 0;
+#else
+    max_chunk_cache_cnt_ = cnt;
+#endif
+    free_list_.set_max_chunk_cache_cnt(cnt);
+    for (int64_t i = 0; i < common::OB_MAX_NUMA_NODE_COUNT; ++i) {
+      numa_free_lists_[i].set_max_chunk_cache_cnt(cnt);
+    }
+  }
 
   inline static AChunk *ptr2chunk(const void *ptr);
   bool update_hold(int64_t bytes, bool high_prio);
@@ -214,10 +226,18 @@ private:
   // wrap for mmap
   void *low_alloc(const uint64_t size, const bool can_use_huge_page, bool &huge_page_used, const bool alloc_shadow);
   void low_free(const void *ptr, const uint64_t size);
+  // Chunks mapped by a thread bound to a numa node are cached per node so that
+  // they are handed out again to threads of the same node.
+  AChunkList &free_list_of(const int64_t numa_slot)
+  { return 0 == numa_slot ? free_list_ : numa_free_lists_[numa_slot - 1]; }
+  AChunk *pop_local_free_chunk();
+  AChunk *pop_any_free_chunk();
 
 protected:
   AChunkList free_list_;
+  AChunkList numa_free_lists_[common::OB_MAX_NUMA_NODE_COUNT];
   ChunkBitMap *chunk_bitmap_;
+  int32_t max_chunk_cache_cnt_;
 
   int64_t limit_;
   int64_t urgent_;
@@ -277,22 +297,34 @@ inline int64_t AChunkMgr::get_used() const
 
 inline int64_t AChunkMgr::get_free_chunk_count() const
 {
-  return free_list_.count();
+  int64_t count = free_list_.count();
+  for (int64_t i = 0; i < common::OB_MAX_NUMA_NODE_COUNT; ++i) {
+    count += numa_free_lists_[i].count();
+  }
+  return count;
 }
 
 inline int64_t AChunkMgr::get_free_chunk_pushes() const
 {
-  return free_list_.get_pushes();
+  int64_t pushes = free_list_.get_pushes();
+  for (int64_t i = 0; i < common::OB_MAX_NUMA_NODE_COUNT; ++i) {
+    pushes += numa_free_lists_[i].get_pushes();
+  }
+  return pushes;
 }
 
 inline int64_t AChunkMgr::get_free_chunk_pops() const
 {
-  return free_list_.get_pops();
+  int64_t pops = free_list_.get_pops();
+  for (int64_t i = 0; i < common::OB_MAX_NUMA_NODE_COUNT; ++i) {
+    pops += numa_free_lists_[i].get_pops();
+  }
+  return pops;
 }
 
 inline int64_t AChunkMgr::get_freelist_hold() const
 {
-  return free_list_.count() * INTACT_ACHUNK_SIZE;
+  return get_free_chunk_count() * INTACT_ACHUNK_SIZE;
 }
 
 } // end of namespace lib
@@ -42,18 +42,20 @@ void ObMemoryCutter::free_chunk(const void *ptr, const uint64_t size)
 void ObMemoryCutter::free_chunk(int64_t &total_size)
 {
   auto &mgr = AChunkMgr::instance();
-  auto &free_list = mgr.free_list_;
-  AChunk *head = free_list.header_;
-  while (head) {
-    if (head->is_valid()) {
-      AChunk *next = head->next_;
-      uint64_t all_size = chunk_size(head);
-      free_chunk(head, all_size);
-      total_size += all_size;
-      head = next;
-    } else {
-      DLOG(WARN, "invalid chunk magic");
-      break;
+  for (int64_t slot = 0; slot <= common::OB_MAX_NUMA_NODE_COUNT; ++slot) {
+    auto &free_list = mgr.free_list_of(slot);
+    AChunk *head = free_list.header_;
+    while (head) {
+      if (head->is_valid()) {
+        AChunk *next = head->next_;
+        uint64_t all_size = chunk_size(head);
+        free_chunk(head, all_size);
+        total_size += all_size;
+        head = next;
+      } else {
+        DLOG(WARN, "invalid chunk magic");
+        break;
+      }
     }
   }
 }
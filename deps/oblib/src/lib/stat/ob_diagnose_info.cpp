@@ -15,6 +15,8 @@
 #include "lib/stat/ob_diagnose_info.h"
 #include "lib/stat/ob_session_stat.h"
 #include "lib/ash/ob_active_session_guard.h"
+#include "lib/coro/co_var.h"
+#include "lib/time/ob_tsc_timestamp.h"
 
 namespace oceanbase
 {
@@ -186,7 +188,7 @@ int ObWaitEventHistory::push(const int64_t event_no, const uint64_t timeout_ms,
     items_[curr_pos_].timeout_ms_ = timeout_ms;
     items_[curr_pos_].is_phy_ = OB_WAIT_EVENTS[event_no].is_phy_;
     if (items_[curr_pos_].is_phy_) {
-      items_[curr_pos_].wait_begin_time_ = ObTimeUtility::current_time();
+      items_[curr_pos_].wait_begin_time_ = OB_TSC_TIMESTAMP.current_time();
     }
     ++nest_cnt_;
     curr_pos_ = (curr_pos_ + 1) % SESSION_WAIT_HISTORY_CNT;
@@ -341,7 +343,7 @@ int ObWaitEventHistory::calc_wait_time(ObWaitEventDesc *&event_desc)
   if (NULL != event_desc) {
     if (0 == event_desc->wait_time_ && 0 == event_desc->wait_end_time_) {
       if (event_desc->is_phy_ && 0 != event_desc->wait_begin_time_) {
-        event_desc->wait_end_time_ = ObTimeUtility::current_time();
+        event_desc->wait_end_time_ = OB_TSC_TIMESTAMP.current_time();
         event_desc->wait_time_ = event_desc->wait_end_time_ - event_desc->wait_begin_time_;
       }
     }
@@ -672,6 +674,8 @@ ObDiagnoseTenantInfo *ObDiagnoseTenantInfo::get_local_diagnose_info()
   return di;
 }
 
+static _RLOCAL(int64_t, wait_event_sample_seq);
+
 ObWaitEventGuard::ObWaitEventGuard(
   const int64_t event_no,
   const uint64_t timeout_ms,
@@ -682,6 +686,7 @@ ObWaitEventGuard::ObWaitEventGuard(
   : event_no_(0),
     wait_begin_time_(0),
     timeout_ms_(0),
+    sample_scale_(0),
     di_(nullptr),
     is_atomic_(is_atomic)
 {
@@ -692,7 +697,13 @@ ObWaitEventGuard::ObWaitEventGuard(
     if (NULL != di_) {
       di_->notify_wait_begin(event_no, timeout_ms, p1, p2, p3, is_atomic);
     } else {
-      wait_begin_time_ = ObTimeUtility::current_time();
+      // waits without a session are mostly short background waits, only one out of
+      // every sample interval of them reads the clock
+      const int64_t sample_interval = lib::get_wait_event_sample_interval();
+      if (OB_LIKELY(sample_interval <= 1) || 0 == ++wait_event_sample_seq % sample_interval) {
+        wait_begin_time_ = OB_TSC_TIMESTAMP.current_time();
+        sample_scale_ = sample_interval <= 1 ? 1 : sample_interval;
+      }
       timeout_ms_ = timeout_ms;
     }
   } else {
@@ -707,16 +718,18 @@ ObWaitEventGuard::~ObWaitEventGuard()
     ObDiagnoseTenantInfo *tenant_di = ObDiagnoseTenantInfo::get_local_diagnose_info();
     if (NULL != di_ && NULL != tenant_di) {
       di_->notify_wait_end(tenant_di, is_atomic_);
-    } else if (NULL == di_ && NULL != tenant_di && 0 != wait_begin_time_) {
+    } else if (NULL == di_ && NULL != tenant_di) {
       ObWaitEventStat *tenant_event_stat = tenant_di->get_event_stats().get(event_no_);
       tenant_event_stat->total_waits_++;
-      wait_time = ObTimeUtility::current_time() - wait_begin_time_;
-      tenant_event_stat->time_waited_ += wait_time;
-      if (timeout_ms_ > 0 && wait_time > static_cast<int64_t>(timeout_ms_) * 1000) {
-        tenant_event_stat->total_timeouts_++;
-      }
-      if (wait_time > static_cast<int64_t>(tenant_event_stat->max_wait_)) {
-        tenant_event_stat->max_wait_ = wait_time;
+      if (0 != wait_begin_time_) {
+        wait_time = OB_TSC_TIMESTAMP.current_time() - wait_begin_time_;
+        tenant_event_stat->time_waited_ += wait_time * sample_scale_;
+        if (timeout_ms_ > 0 && wait_time > static_cast<int64_t>(timeout_ms_) * 1000) {
+          tenant_event_stat->total_timeouts_ += sample_scale_;
+        }
+        if (wait_time > static_cast<int64_t>(tenant_event_stat->max_wait_)) {
+          tenant_event_stat->max_wait_ = wait_time;
+        }
       }
     }
   }
@@ -177,6 +177,8 @@ private:
   int64_t event_no_;
   uint64_t wait_begin_time_;
   uint64_t timeout_ms_;
+  // weight of a timed wait without session, 0 if this wait is not sampled
+  int64_t sample_scale_;
   ObDiagnoseSessionInfo *di_;
   bool is_atomic_;
   //Do you need statistics
@@ -332,6 +332,8 @@ STAT_EVENT_ADD_DEF(INDEX_BLOCK_CACHE_HIT, "index micro block cache hit", ObStatC
 STAT_EVENT_ADD_DEF(BLOCKSCAN_BLOCK_CNT, "blockscaned data micro block count", ObStatClassIds::STORAGE, "blockscaned data micro block count", 60088, true, true)
 STAT_EVENT_ADD_DEF(BLOCKSCAN_ROW_CNT, "blockscaned row count", ObStatClassIds::STORAGE, "blockscaned row count", 60089, true, true)
 STAT_EVENT_ADD_DEF(PUSHDOWN_STORAGE_FILTER_ROW_CNT, "storage filtered row count", ObStatClassIds::STORAGE, "storage filter row count", 60090, true, true)
+STAT_EVENT_ADD_DEF(MEMSTORE_READ_WALK_COUNT, "memstore read walk count", ObStatClassIds::STORAGE, "memstore read walk count", 60091, true, true)
+STAT_EVENT_ADD_DEF(MEMSTORE_READ_WALK_NODE_COUNT, "memstore read walk trans node count", ObStatClassIds::STORAGE, "memstore read walk trans node count", 60092, true, true)
 
 // backup & restore
 STAT_EVENT_ADD_DEF(BACKUP_IO_READ_COUNT, "backup io read count", ObStatClassIds::STORAGE, "backup io read count", 69000, true, true)
@@ -416,36 +416,32 @@ void ObTrace::end()
   reset();
 }
 
-ObSpanCtx* ObTrace::begin_span(uint32_t span_type, uint8_t level, bool is_follow)
+ObSpanCtx* ObTrace::begin_span_(uint32_t span_type, bool is_follow)
 {
   ObSpanCtx* new_span = nullptr;
-  if (!trace_id_.is_inited() || level > level_) {
-    // do nothing
+  if (freed_span_.is_empty()) {
+    FLUSH_TRACE();
+  }
+  if (freed_span_.is_empty()) {
+    check_leak_span();
   } else {
-    if (freed_span_.is_empty()) {
-      FLUSH_TRACE();
-    }
-    if (freed_span_.is_empty()) {
-      check_leak_span();
-    } else {
-      new_span = freed_span_.remove_last();
-      current_span_.add_first(new_span);
-      new_span->span_type_ = span_type;
-      new_span->span_id_.low_ = ++seq_;
-      new_span->source_span_ = last_active_span_;
-      new_span->is_follow_ = is_follow;
-      new_span->start_ts_ = ObTimeUtility::fast_current_time();
-      new_span->end_ts_ = 0;
-      new_span->tags_ = nullptr;
-      last_active_span_ = new_span;
-    }
+    new_span = freed_span_.remove_last();
+    current_span_.add_first(new_span);
+    new_span->span_type_ = span_type;
+    new_span->span_id_.low_ = ++seq_;
+    new_span->source_span_ = last_active_span_;
+    new_span->is_follow_ = is_follow;
+    new_span->start_ts_ = ObTimeUtility::fast_current_time();
+    new_span->end_ts_ = 0;
+    new_span->tags_ = nullptr;
+    last_active_span_ = new_span;
   }
   return new_span;
 }
 
-void ObTrace::end_span(ObSpanCtx* span)
+void ObTrace::end_span_(ObSpanCtx* span)
 {
-  if (!trace_id_.is_inited() || OB_ISNULL(span) || !span->span_id_.is_inited()) {
+  if (!span->span_id_.is_inited()) {
     // do nothing
   } else {
     span->end_ts_ = ObTimeUtility::fast_current_time();
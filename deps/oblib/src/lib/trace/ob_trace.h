@@ -224,8 +224,19 @@ struct ObTrace
   bool is_inited() { return check_magic() && trace_id_.is_inited(); }
   UUID begin();
   void end();
-  ObSpanCtx* begin_span(uint32_t span_type, uint8_t level, bool is_follow);
-  void end_span(ObSpanCtx* span_id);
+  // requests not sampled leave trace_id_ empty, so span calls stay one inline branch for them
+  OB_INLINE ObSpanCtx* begin_span(uint32_t span_type, uint8_t level, bool is_follow)
+  {
+    return OB_LIKELY(!trace_id_.is_inited() || level > level_) ? nullptr : begin_span_(span_type, is_follow);
+  }
+  OB_INLINE void end_span(ObSpanCtx* span)
+  {
+    if (OB_LIKELY(OB_ISNULL(span) || !trace_id_.is_inited())) {
+      // do nothing
+    } else {
+      end_span_(span);
+    }
+  }
   void reset_span();
   template <typename T, typename... Targs>
   void set_tag(ObTagType tag_type, const T& value, Targs... Fargs)
@@ -300,6 +311,8 @@ struct ObTrace
     return append_tag(tag_type, OB_ISNULL(value) ? ObString("") : ObString(value));
   }
 private:
+  ObSpanCtx* begin_span_(uint32_t span_type, bool is_follow);
+  void end_span_(ObSpanCtx* span);
   bool check_magic() { return MAGIC_CODE == magic_code_; }
   void set_tag() {}
 private:
@@ -13,6 +13,7 @@
 #define USING_LOG_PREFIX RPC_FRAME
 
 #include "io/easy_io.h"
+#include "io/easy_message.h"
 #include "rpc/frame/ob_net_easy.h"
 
 #include "lib/ob_define.h"
@@ -516,14 +517,18 @@ static void rpc_easy_timer_cb(EV_P_ ev_timer *w, int revents)
   UNUSED(loop);
   UNUSED(w);
   UNUSED(revents);
-  char log_str[256];
+  char log_str[512];
   const int64_t DOING_REQUEST_WARN_THRESHOLD = 10 * 10000;
 
   if (NULL != EASY_IOTH_SELF) {
-    snprintf(log_str, 256, "conn count=%d/%d, request done=%" PRIu64 "/%" PRIu64 ", request doing=%d/%d",
+    easy_message_pool_cache_trim(EASY_IOTH_SELF);
+    snprintf(log_str, 512, "conn count=%d/%d, request done=%" PRIu64 "/%" PRIu64 ", request doing=%d/%d"
+        ", msg pool cached=%d, hit/miss/trim=%" PRIu64 "/%" PRIu64 "/%" PRIu64,
         EASY_IOTH_SELF->tx_conn_count,          EASY_IOTH_SELF->rx_conn_count,
         EASY_IOTH_SELF->tx_done_request_count,  EASY_IOTH_SELF->rx_done_request_count,
-        EASY_IOTH_SELF->tx_doing_request_count, EASY_IOTH_SELF->rx_doing_request_count);
+        EASY_IOTH_SELF->tx_doing_request_count, EASY_IOTH_SELF->rx_doing_request_count,
+        EASY_IOTH_SELF->msg_pool_cache_count,   EASY_IOTH_SELF->msg_pool_cache_hit,
+        EASY_IOTH_SELF->msg_pool_cache_miss,    EASY_IOTH_SELF->msg_pool_cache_trim);
     LOG_INFO("[RPC EASY STAT]", KCSTRING(log_str));
   } else {
     LOG_ERROR("EASY_IOTH_SELF is NULL");
@@ -535,14 +540,18 @@ static void high_prio_rpc_easy_timer_cb(EV_P_ ev_timer *w, int revents)
   UNUSED(loop);
   UNUSED(w);
   UNUSED(revents);
-  char log_str[256];
+  char log_str[512];
   const int64_t DOING_REQUEST_WARN_THRESHOLD = 10 * 10000;
 
   if (NULL != EASY_IOTH_SELF) {
-    snprintf(log_str, 256, "conn count=%d/%d, request done=%" PRIu64 "/%" PRIu64 ", request doing=%d/%d",
+    easy_message_pool_cache_trim(EASY_IOTH_SELF);
+    snprintf(log_str, 512, "conn count=%d/%d, request done=%" PRIu64 "/%" PRIu64 ", request doing=%d/%d"
+        ", msg pool cached=%d, hit/miss/trim=%" PRIu64 "/%" PRIu64 "/%" PRIu64,
         EASY_IOTH_SELF->tx_conn_count,          EASY_IOTH_SELF->rx_conn_count,
         EASY_IOTH_SELF->tx_done_request_count,  EASY_IOTH_SELF->rx_done_request_count,
-        EASY_IOTH_SELF->tx_doing_request_count, EASY_IOTH_SELF->rx_doing_request_count);
+        EASY_IOTH_SELF->tx_doing_request_count, EASY_IOTH_SELF->rx_doing_request_count,
+        EASY_IOTH_SELF->msg_pool_cache_count,   EASY_IOTH_SELF->msg_pool_cache_hit,
+        EASY_IOTH_SELF->msg_pool_cache_miss,    EASY_IOTH_SELF->msg_pool_cache_trim);
     LOG_INFO("[HIGH PRIO RPC EASY STAT]", KCSTRING(log_str));
   } else {
     LOG_ERROR("EASY_IOTH_SELF is NULL");
@@ -554,14 +563,18 @@ static void batch_rpc_easy_timer_cb(EV_P_ ev_timer *w, int revents)
   UNUSED(loop);
   UNUSED(w);
   UNUSED(revents);
-  char log_str[256];
+  char log_str[512];
   const int64_t DOING_REQUEST_WARN_THRESHOLD = 10 * 10000;
 
   if (NULL != EASY_IOTH_SELF) {
-    snprintf(log_str, 256, "conn count=%d/%d, request done=%" PRIu64 "/%" PRIu64 ", request doing=%d/%d",
+    easy_message_pool_cache_trim(EASY_IOTH_SELF);
+    snprintf(log_str, 512, "conn count=%d/%d, request done=%" PRIu64 "/%" PRIu64 ", request doing=%d/%d"
+        ", msg pool cached=%d, hit/miss/trim=%" PRIu64 "/%" PRIu64 "/%" PRIu64,
         EASY_IOTH_SELF->tx_conn_count,          EASY_IOTH_SELF->rx_conn_count,
         EASY_IOTH_SELF->tx_done_request_count,  EASY_IOTH_SELF->rx_done_request_count,
-        EASY_IOTH_SELF->tx_doing_request_count, EASY_IOTH_SELF->rx_doing_request_count);
+        EASY_IOTH_SELF->tx_doing_request_count, EASY_IOTH_SELF->rx_doing_request_count,
+        EASY_IOTH_SELF->msg_pool_cache_count,   EASY_IOTH_SELF->msg_pool_cache_hit,
+        EASY_IOTH_SELF->msg_pool_cache_miss,    EASY_IOTH_SELF->msg_pool_cache_trim);
     LOG_INFO("[BATCH_RPC EASY STAT]", KCSTRING(log_str));
   } else {
     LOG_ERROR("EASY_IOTH_SELF is NULL");
@@ -573,14 +586,18 @@ static void mysql_easy_timer_cb(EV_P_ ev_timer *w, int revents)
   UNUSED(loop);
   UNUSED(w);
   UNUSED(revents);
-  char log_str[256];
+  char log_str[512];
   const int64_t DOING_REQUEST_WARN_THRESHOLD = 10 * 10000;
 
   if (NULL != EASY_IOTH_SELF) {
-    snprintf(log_str, 256, "conn count=%d/%d, request done=%" PRIu64 "/%" PRIu64 ", request doing=%d/%d",
+    easy_message_pool_cache_trim(EASY_IOTH_SELF);
+    snprintf(log_str, 512, "conn count=%d/%d, request done=%" PRIu64 "/%" PRIu64 ", request doing=%d/%d"
+        ", msg pool cached=%d, hit/miss/trim=%" PRIu64 "/%" PRIu64 "/%" PRIu64,
         EASY_IOTH_SELF->tx_conn_count,          EASY_IOTH_SELF->rx_conn_count,
         EASY_IOTH_SELF->tx_done_request_count,  EASY_IOTH_SELF->rx_done_request_count,
-        EASY_IOTH_SELF->tx_doing_request_count, EASY_IOTH_SELF->rx_doing_request_count);
+        EASY_IOTH_SELF->tx_doing_request_count, EASY_IOTH_SELF->rx_doing_request_count,
+        EASY_IOTH_SELF->msg_pool_cache_count,   EASY_IOTH_SELF->msg_pool_cache_hit,
+        EASY_IOTH_SELF->msg_pool_cache_miss,    EASY_IOTH_SELF->msg_pool_cache_trim);
 
     if ((EASY_IOTH_SELF->tx_doing_request_count >= DOING_REQUEST_WARN_THRESHOLD) ||
         (EASY_IOTH_SELF->rx_doing_request_count >= DOING_REQUEST_WARN_THRESHOLD)) {
@@ -383,6 +383,28 @@ public:
     last_write_time_ = ObTimeUtility::current_time();
     return ret;
   }
+  // write without waiting for the socket to become writable, stop at EAGAIN
+  int try_write_data(const char* buf, int64_t sz, int64_t& pos) {
+    int ret = OB_SUCCESS;
+    pos = 0;
+    while(pos < sz && OB_SUCCESS == ret) {
+      int64_t wbytes = 0;
+      if ((wbytes = write(fd_, buf + pos, sz - pos)) >= 0) {
+        pos += wbytes;
+      } else if (EAGAIN == errno || EWOULDBLOCK == errno) {
+        break;
+      } else if (EINTR == errno) {
+        // pass
+      } else {
+        ret = OB_IO_ERROR;
+        LOG_WARN("write data error", K(errno));
+      }
+    }
+    if (pos >= sz) {
+      last_write_time_ = ObTimeUtility::current_time();
+    }
+    return ret;
+  }
   const rpc::TraceId* get_trace_id() const {
     ObSqlSockSession* sess = (ObSqlSockSession *)sess_;
     return &(sess->sql_req_.get_trace_id());
@@ -943,6 +965,11 @@ int ObSqlNio::write_data(void* sess, const char* buf, int64_t sz)
   return sess2sock(sess)->write_data(buf, sz);
 }
 
+int ObSqlNio::try_write_data(void* sess, const char* buf, int64_t sz, int64_t& wbytes)
+{
+  return sess2sock(sess)->try_write_data(buf, sz, wbytes);
+}
+
 void ObSqlNio::async_write_data(void* sess, const char* buf, int64_t sz)
 {
   ObSqlSock* sock = sess2sock(sess);
@@ -34,6 +34,7 @@ public:
   int peek_data(void* sess, int64_t limit, const char*& buf, int64_t& sz);
   int consume_data(void* sess, int64_t sz);
   int write_data(void* sess, const char* buf, int64_t sz);
+  int try_write_data(void* sess, const char* buf, int64_t sz, int64_t& wbytes);
   void async_write_data(void* sess, const char* buf, int64_t sz);
   void stop();
   void wait();
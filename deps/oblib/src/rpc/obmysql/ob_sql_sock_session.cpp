@@ -76,9 +76,18 @@ void ObSqlSockSession::revert_sock()
   if (pending_write_buf_) {
     const char * data = pending_write_buf_;
     int64_t sz = pending_write_sz_;
+    int64_t wbytes = 0;
     pending_write_buf_ = NULL;
     pending_write_sz_ = 0;
-    nio_.async_write_data((void*)this, data, sz);
+    // Most responses fit in the socket send buffer, write them here so that the
+    // nio thread is not woken up for every statement and a pipelined request
+    // already buffered is picked up by revert_sock right away. Whatever can not
+    // be written without blocking, or fails, is left to the nio thread.
+    if (OB_SUCCESS == nio_.try_write_data((void*)this, data, sz, wbytes) && wbytes >= sz) {
+      on_flushed();
+    } else {
+      nio_.async_write_data((void*)this, data + wbytes, sz - wbytes);
+    }
   } else {
     pool_.reuse();
     nio_.revert_sock((void*)this);
@@ -82,3 +82,63 @@ TEST_F(TestChunkMgr, FreeListManyChunk)
   EXPECT_EQ(500*2, free_list_.get_pushes());
   EXPECT_EQ(500, free_list_.get_pops());
 }
+
+TEST_F(TestChunkMgr, NumaFreeList)
+{
+  // nothing to tell apart on a single node host, or where the thread may not be bound
+  if (get_numa_node_count() <= 1) {
+    return;
+  } else if (OB_SUCCESS != bind_thread_to_numa_node(0)) {
+    return;
+  }
+  ASSERT_EQ(0, get_thread_numa_node());
+  {
+    AChunk *chunk = alloc_chunk(0);
+    ASSERT_EQ(1, chunk->numa_slot_);
+    free_chunk(chunk);
+    EXPECT_EQ(1, numa_free_lists_[0].get_pushes());
+    EXPECT_EQ(0, free_list_.get_pushes());
+  }
+  ASSERT_EQ(OB_SUCCESS, bind_thread_to_numa_node(-1));
+  ASSERT_EQ(-1, get_thread_numa_node());
+  {
+    // the chunk cached for node 0 is not handed out to an unbound thread
+    AChunk *chunk = alloc_chunk(0);
+    ASSERT_EQ(0, chunk->numa_slot_);
+    EXPECT_EQ(0, numa_free_lists_[0].get_pops());
+    free_chunk(chunk);
+    EXPECT_EQ(1, free_list_.get_pushes());
+    EXPECT_EQ(2, get_free_chunk_count());
+  }
+}
+
+TEST_F(TestChunkMgr, NumaBindFailure)
+{
+  ASSERT_FALSE(is_numa_node_bindable(-1));
+  ASSERT_FALSE(is_numa_node_bindable(OB_MAX_NUMA_NODE_COUNT));
+  // a failed bind leaves the thread as it was and is not retried for the same node
+  ASSERT_EQ(OB_INVALID_ARGUMENT, bind_thread_to_numa_node(OB_MAX_NUMA_NODE_COUNT));
+  ASSERT_EQ(-1, get_thread_numa_node());
+  ASSERT_EQ(OB_SUCCESS, bind_thread_to_numa_node(OB_MAX_NUMA_NODE_COUNT));
+  ASSERT_EQ(-1, get_thread_numa_node());
+  ASSERT_EQ(OB_SUCCESS, bind_thread_to_numa_node(-1));
+  ASSERT_EQ(-1, get_thread_numa_node());
+}
+
+TEST_F(TestChunkMgr, NumaFreeListTotalLimit)
+{
+  const int64_t cache_cnt = 4;
+  AChunk *chunks[cache_cnt * 2] = {};
+  set_max_chunk_cache_cnt(cache_cnt);
+  for (int64_t i = 0; i < cache_cnt * 2; i++) {
+    chunks[i] = alloc_chunk(OB_MALLOC_BIG_BLOCK_SIZE);
+    ASSERT_NE(nullptr, chunks[i]);
+    // spread the chunks over the shared list and the lists of two nodes
+    chunks[i]->numa_slot_ = static_cast<uint8_t>(i % 3);
+  }
+  for (int64_t i = 0; i < cache_cnt * 2; i++) {
+    free_chunk(chunks[i]);
+  }
+  EXPECT_EQ(cache_cnt, get_free_chunk_count());
+  EXPECT_EQ(cache_cnt, get_free_chunk_pushes());
+}
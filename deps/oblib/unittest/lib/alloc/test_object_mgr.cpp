@@ -236,6 +236,79 @@ TEST_F(TestObjectMgr, TestFragmentWash)
 }
 
 
+TEST_F(TestObjectMgr, TestThreadCache)
+{
+  auto ta = ObMallocAllocator::get_instance()->get_tenant_ctx_allocator(
+      OB_SERVER_TENANT_ID, ObCtxIds::DEFAULT_CTX_ID);
+  auto &om = static_cast<ObjectMgr&>(ta->get_block_mgr());
+  auto alloc_bytes = [&om]() {
+    uint64_t bytes = 0;
+    for (int i = 0; i < ATOMIC_LOAD(&om.sub_cnt_); i++) {
+      if (om.sub_mgrs_[i] != nullptr) {
+        bytes += om.sub_mgrs_[i]->os_.get_alloc_bytes();
+      }
+    }
+    return bytes;
+  };
+  ObjectThreadCache::set_enabled(true);
+  // the first free creates the slots
+  ob_free(ob_malloc(100, "TCache"));
+  ta->sync_wash(INT64_MAX);
+  const uint64_t bytes_before = alloc_bytes();
+
+  void *p = ob_malloc(100, "TCache");
+  ASSERT_NE(nullptr, p);
+  ob_free(p);
+  // same cells, handed out again by the slot of this thread
+  void *q = ob_malloc(104, "TCache");
+  ASSERT_EQ(p, q);
+  AObject *obj = reinterpret_cast<AObject*>((char*)q - AOBJECT_HEADER_SIZE);
+  ASSERT_EQ(104U, obj->alloc_bytes_);
+  ASSERT_TRUE(obj->from_tcache_);
+  ASSERT_EQ(0, STRCMP("TCache", obj->label_));
+  ob_free(q);
+  ASSERT_EQ(0, STRCMP(ObjectThreadCache::LABEL, obj->label_));
+
+  // long lists return half of their objects to the sets
+  void *ptrs[ObjectThreadCache::MAX_CACHE_CNT * 2];
+  for (int i = 0; i < ARRAYSIZEOF(ptrs); i++) {
+    ptrs[i] = ob_malloc(200, "TCache");
+    ASSERT_NE(nullptr, ptrs[i]);
+  }
+  for (int i = 0; i < ARRAYSIZEOF(ptrs); i++) {
+    ob_free(ptrs[i]);
+  }
+  ta->sync_wash(INT64_MAX);
+  // sets account for what they handed out, whatever size the cache reused objects with
+  ASSERT_EQ(bytes_before, alloc_bytes());
+
+  ObjectThreadCache::set_enabled(false);
+  p = ob_malloc(100, "TCache");
+  ob_free(p);
+  ASSERT_EQ(bytes_before, alloc_bytes());
+  ObjectThreadCache::set_enabled(true);
+
+  // the periodic flush returns what the threads cached without disabling the cache
+  for (int i = 0; i < ARRAYSIZEOF(ptrs); i++) {
+    ptrs[i] = ob_malloc(300, "TCache");
+    ASSERT_NE(nullptr, ptrs[i]);
+  }
+  for (int i = 0; i < ARRAYSIZEOF(ptrs); i++) {
+    ob_free(ptrs[i]);
+  }
+  ASSERT_LT(bytes_before, alloc_bytes());
+  ObMallocAllocator::get_instance()->flush_object_thread_cache();
+  ASSERT_EQ(bytes_before, alloc_bytes());
+  p = ob_malloc(100, "TCache");
+  ob_free(p);
+  q = ob_malloc(100, "TCache");
+  ASSERT_EQ(p, q);
+  ob_free(q);
+  ObMallocAllocator::get_instance()->flush_object_thread_cache();
+  ASSERT_EQ(bytes_before, alloc_bytes());
+  ObjectThreadCache::set_enabled(false);
+}
+
 TEST_F(TestObjectMgr, TestSubObjectMgr)
 {
   AChunkMgr::instance().set_max_chunk_cache_cnt(0);
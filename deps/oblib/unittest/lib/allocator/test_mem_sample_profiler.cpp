@@ -0,0 +1,161 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#include <thread>
+#include "lib/allocator/ob_mem_sample_profiler.h"
+#include "lib/allocator/ob_malloc.h"
+using namespace oceanbase::common;
+using namespace oceanbase::lib;
+
+typedef ObMemSampleProfiler::Bucket Bucket;
+
+static int64_t sampled_bytes(Bucket *buckets, const char *label)
+{
+  int64_t count = 0;
+  int64_t interval = 0;
+  int64_t bytes = 0;
+  EXPECT_EQ(OB_SUCCESS, ObMemSampleProfiler::get_instance().snapshot(buckets, count, interval));
+  for (int64_t i = 0; i < count; ++i) {
+    if (0 == STRCMP(buckets[i].label_, label)) {
+      bytes += buckets[i].get_est_bytes();
+    }
+  }
+  return bytes;
+}
+
+static int64_t sampled_count(Bucket *buckets, const char *label)
+{
+  int64_t count = 0;
+  int64_t interval = 0;
+  int64_t sample_cnt = 0;
+  EXPECT_EQ(OB_SUCCESS, ObMemSampleProfiler::get_instance().snapshot(buckets, count, interval));
+  for (int64_t i = 0; i < count; ++i) {
+    if (0 == STRCMP(buckets[i].label_, label)) {
+      sample_cnt += buckets[i].count_;
+    }
+  }
+  return sample_cnt;
+}
+
+TEST(TestMemSampleProfiler, estimate)
+{
+  const int64_t alloc_size = 1024;
+  const int64_t alloc_cnt = 100000;
+  Bucket *buckets = new Bucket[ObMemSampleProfiler::BUCKET_COUNT];
+  ObMemSampleProfiler &profiler = ObMemSampleProfiler::get_instance();
+  profiler.set_interval(64 * 1024);
+  for (int64_t i = 0; i < alloc_cnt; ++i) {
+    void *ptr = ob_malloc(alloc_size, ObMemAttr(OB_SERVER_TENANT_ID, "SampleTest"));
+    ASSERT_NE(nullptr, ptr);
+    ob_free(ptr);
+  }
+  // the estimate is unbiased, 100MB at 64KB intervals is about 1600 samples
+  const int64_t bytes = sampled_bytes(buckets, "SampleTest");
+  ASSERT_GT(bytes, alloc_size * alloc_cnt * 8 / 10);
+  ASSERT_LT(bytes, alloc_size * alloc_cnt * 12 / 10);
+
+  ASSERT_EQ(OB_SUCCESS, profiler.dump_pprof("test_mem_sample_profiler.prof"));
+  FILE *file = fopen("test_mem_sample_profiler.prof", "r");
+  ASSERT_NE(nullptr, file);
+  char line[256];
+  ASSERT_NE(nullptr, fgets(line, sizeof(line), file));
+  ASSERT_EQ(0, STRNCMP(line, "heap profile:", STRLEN("heap profile:")));
+  fclose(file);
+
+  // turning sampling off drops the samples and stops taking new ones
+  profiler.set_interval(0);
+  void *ptr = ob_malloc(1 << 20, ObMemAttr(OB_SERVER_TENANT_ID, "SampleTest"));
+  ASSERT_NE(nullptr, ptr);
+  ob_free(ptr);
+  ASSERT_EQ(0, sampled_bytes(buckets, "SampleTest"));
+  delete [] buckets;
+}
+
+TEST(TestMemSampleProfiler, estimate_small_objects)
+{
+  const int64_t alloc_size = 1024;
+  const int64_t alloc_cnt = 100000;
+  Bucket *buckets = new Bucket[ObMemSampleProfiler::BUCKET_COUNT];
+  ObMemSampleProfiler &profiler = ObMemSampleProfiler::get_instance();
+  // an allocation as large as the interval is sampled with probability 1 - 1/e, each
+  // sample stands for about 1.58 allocations
+  profiler.set_interval(alloc_size);
+  for (int64_t i = 0; i < alloc_cnt; ++i) {
+    void *ptr = ob_malloc(alloc_size, ObMemAttr(OB_SERVER_TENANT_ID, "SampleSmall"));
+    ASSERT_NE(nullptr, ptr);
+    ob_free(ptr);
+  }
+  int64_t count = 0;
+  int64_t interval = 0;
+  double est_count = 0;
+  ASSERT_EQ(OB_SUCCESS, profiler.snapshot(buckets, count, interval));
+  for (int64_t i = 0; i < count; ++i) {
+    if (0 == STRCMP(buckets[i].label_, "SampleSmall")) {
+      est_count += buckets[i].est_count_;
+    }
+  }
+  ASSERT_GT(est_count, alloc_cnt * 0.95);
+  ASSERT_LT(est_count, alloc_cnt * 1.05);
+  profiler.set_interval(0);
+  delete [] buckets;
+}
+
+TEST(TestMemSampleProfiler, many_threads)
+{
+  const int64_t thread_cnt = 64;
+  const int64_t alloc_cnt = 1000;
+  const int64_t alloc_size = 1024;
+  Bucket *buckets = new Bucket[ObMemSampleProfiler::BUCKET_COUNT];
+  ObMemSampleProfiler &profiler = ObMemSampleProfiler::get_instance();
+  // at 1GB intervals a 1KB allocation is hardly ever sampled, unless the countdown
+  // of a new thread starts expired
+  profiler.set_interval(1L << 30);
+  std::thread threads[thread_cnt];
+  for (int64_t i = 0; i < thread_cnt; ++i) {
+    threads[i] = std::thread([&]() {
+      void *ptr = ob_malloc(alloc_size, ObMemAttr(OB_SERVER_TENANT_ID, "SampleFirst"));
+      EXPECT_NE(nullptr, ptr);
+      ob_free(ptr);
+    });
+  }
+  for (int64_t i = 0; i < thread_cnt; ++i) {
+    threads[i].join();
+  }
+  ASSERT_LE(sampled_count(buckets, "SampleFirst"), 1);
+
+  // threads sampling concurrently still add up to an unbiased estimate
+  profiler.set_interval(64 * 1024);
+  for (int64_t i = 0; i < thread_cnt; ++i) {
+    threads[i] = std::thread([&]() {
+      for (int64_t j = 0; j < alloc_cnt; ++j) {
+        void *ptr = ob_malloc(alloc_size, ObMemAttr(OB_SERVER_TENANT_ID, "SampleThreads"));
+        EXPECT_NE(nullptr, ptr);
+        ob_free(ptr);
+      }
+    });
+  }
+  for (int64_t i = 0; i < thread_cnt; ++i) {
+    threads[i].join();
+  }
+  const int64_t bytes = sampled_bytes(buckets, "SampleThreads");
+  ASSERT_GT(bytes, thread_cnt * alloc_cnt * alloc_size * 8 / 10);
+  ASSERT_LT(bytes, thread_cnt * alloc_cnt * alloc_size * 12 / 10);
+  profiler.set_interval(0);
+  delete [] buckets;
+}
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
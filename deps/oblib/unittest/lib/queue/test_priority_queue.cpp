@@ -15,6 +15,7 @@
 #include "lib/queue/ob_priority_queue.h"
 #include "lib/thread/thread_pool.h"
 #include <iostream>
+#include <thread>
 
 using namespace oceanbase::lib;
 using namespace oceanbase::common;
@@ -126,6 +127,31 @@ TEST(TestPriorityQueue, WithCoro)
   tq.do_stress();
 }
 
+TEST(TestPriorityQueue, WakeupSleepingPopper)
+{
+  typedef ObPriorityQueue2<1, 2> Queue;
+  Queue queue;
+  TestQueue::QData data(1);
+  ObLink *task = NULL;
+  int pop_ret = OB_SUCCESS;
+  int64_t pop_cost = 0;
+  std::thread popper([&]() {
+    const int64_t start = ObTimeUtility::current_time();
+    do {
+      pop_ret = queue.pop(task, 10 * 1000 * 1000);
+    } while (OB_ENTRY_NOT_EXIST == pop_ret && ObTimeUtility::current_time() - start < 10 * 1000 * 1000);
+    pop_cost = ObTimeUtility::current_time() - start;
+  });
+  ::usleep(100 * 1000);
+  // the popper is asleep in the cond by now, the push has to wake it up
+  ASSERT_EQ(OB_SUCCESS, queue.push(&data, 2));
+  popper.join();
+  ASSERT_EQ(OB_SUCCESS, pop_ret);
+  ASSERT_EQ(&data, task);
+  ASSERT_LT(pop_cost, 5 * 1000 * 1000);
+  ASSERT_EQ(0, queue.size());
+}
+
 int main(int argc, char *argv[])
 {
   oceanbase::common::ObLogger::get_logger().set_log_level("debug");
@@ -121,6 +121,21 @@ TEST_F(TestContext, Basic)
       }
       ASSERT_TRUE(has_unfree);
       ASSERT_EQ(orig_pm_used, g_pm.used_);
+      has_unfree = false;
+      CREATE_WITH_TEMP_CONTEXT(param) {
+        for (int i = 0; i < 64; ++i) {
+          ptr = ctxalp(1024);
+          ASSERT_NE(ptr, nullptr);
+          ptr = ctxalf(100);
+          ASSERT_NE(ptr, nullptr);
+          ctxfree(ptr);
+        }
+      } else {
+        ASSERT_TRUE(false);
+      }
+      // everything freed, destroying the context must not report
+      ASSERT_FALSE(has_unfree);
+      ASSERT_EQ(orig_pm_used, g_pm.used_);
       CREATE_WITH_TEMP_CONTEXT(param) {
         {
           // In order to allow the object_set inside current_ctx to allocate free_list in advance
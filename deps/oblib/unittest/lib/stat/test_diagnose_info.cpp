@@ -11,6 +11,7 @@
  */
 
 #include <gtest/gtest.h>
+#include <thread>
 #define private public
 #include "lib/stat/ob_diagnose_info.h"
 #include "lib/stat/ob_session_stat.h"
@@ -203,6 +204,28 @@ TEST(ObDiagnoseSessionInfo, normal)
   }
 }
 
+TEST(ObDiagnoseTenantInfo, sampled_wait_event)
+{
+  std::thread th([]() {
+    lib::reload_wait_event_sample_config(4);
+    ASSERT_TRUE(NULL == ObDiagnoseSessionInfo::get_local_diagnose_info());
+    ObDiagnoseTenantInfo *tenant_info = ObDiagnoseTenantInfo::get_local_diagnose_info();
+    ASSERT_TRUE(NULL != tenant_info);
+    ObWaitEventStat *event_stat = tenant_info->get_event_stats().get(ObWaitEventIds::DEFAULT_SLEEP);
+    ASSERT_TRUE(NULL != event_stat);
+    const uint64_t total_waits = event_stat->total_waits_;
+    const uint64_t time_waited = event_stat->time_waited_;
+    for (int i = 0; i < 8; i++) {
+      USLEEP(1000);
+    }
+    // every wait is counted, only two of them are timed and scaled by the interval
+    EXPECT_EQ(total_waits + 8, event_stat->total_waits_);
+    EXPECT_LE(time_waited + 2 * 4 * 1000, event_stat->time_waited_);
+    lib::reload_wait_event_sample_config(1);
+  });
+  th.join();
+}
+
 class AtomicWaitEventTestRun : public cotesting::DefaultRunnable
 {
 public:
@@ -574,12 +574,10 @@ int ObMPUtils::init_flt_log_framework(sql::ObSQLSessionInfo &sess, bool is_clien
 
       FLTControlInfo con = sess.get_control_info();
       if (con.is_valid()) {
-        // init trace enable
-        omt::ObTenantConfigGuard tenant_config(TENANT_CONF(sess.get_effective_tenant_id()));
-        con.print_sample_pct_ = ((double)(tenant_config->_print_sample_ppm))/1000000;
-        ObRandom r;
-        double rand_num = 1.0 * (r.rand(0, RAND_MAX)/RAND_MAX);
-        if (rand_num < con.sample_pct_) {
+        // init trace enable, sampling is decided here once for the whole request and
+        // requests not sampled never touch the tenant config or the random generator
+        if (con.sample_pct_ > 0
+            && 1.0 * ObRandom::rand(0, RAND_MAX) / RAND_MAX < con.sample_pct_) {
           sess.set_trace_enable(true);
         } else {
           sess.set_trace_enable(false);
@@ -595,8 +593,10 @@ int ObMPUtils::init_flt_log_framework(sql::ObSQLSessionInfo &sess, bool is_clien
         } else if (con.rp_ == FLTControlInfo::RecordPolicy::RP_ONLY_SLOW_QUERY) {
           // do nothing, slow query will must flush
         } else if (con.rp_ == FLTControlInfo::RecordPolicy::RP_SAMPLE_AND_SLOW_QUERY) {
-          double rand_num2 = 1.0 * (r.rand(0, RAND_MAX)/RAND_MAX);
-          if (rand_num2 < con.print_sample_pct_) {
+          omt::ObTenantConfigGuard tenant_config(TENANT_CONF(sess.get_effective_tenant_id()));
+          con.print_sample_pct_ = ((double)(tenant_config->_print_sample_ppm))/1000000;
+          if (con.print_sample_pct_ > 0
+              && 1.0 * ObRandom::rand(0, RAND_MAX) / RAND_MAX < con.print_sample_pct_) {
             sess.set_auto_flush_trace(true);
           } else {
             sess.set_auto_flush_trace(false);
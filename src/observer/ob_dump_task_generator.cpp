@@ -15,6 +15,7 @@
 #include "observer/ob_dump_task_generator.h"
 #include "lib/alloc/memory_dump.h"
 #include "lib/allocator/ob_mem_leak_checker.h"
+#include "lib/allocator/ob_mem_sample_profiler.h"
 #include "lib/utility/ob_fast_convert.h"
 #include "share/ob_define.h"
 #include "share/ob_errno.h"
@@ -212,6 +213,12 @@ void ObDumpTaskGenerator::dump_memory_leak()
   if (fd >= 0) {
     ::close(fd);
   }
+  // samples of _memory_sample_interval go to a separate file readable by pprof
+  if (ObMemSampleProfiler::get_instance().get_interval() > 0) {
+    if (OB_FAIL(ObMemSampleProfiler::get_instance().dump_pprof("log/memory_sample.prof"))) {
+      LOG_WARN("dump memory samples failed", K(ret));
+    }
+  }
 }
 
 }
@@ -92,6 +92,7 @@
 #include "storage/compaction/ob_compaction_diagnose.h"
 #include "storage/ob_file_system_router.h"
 #include "storage/blocksstable/ob_storage_cache_suite.h"
+#include "storage/blocksstable/ob_macro_block_writer.h"
 #include "storage/tablelock/ob_table_lock_rpc_client.h"
 #include "share/ash/ob_active_sess_hist_task.h"
 #include "share/ash/ob_active_sess_hist_list.h"
@@ -346,6 +347,8 @@ int ObServer::init(const ObServerOptions &opts, const ObPLogWriterCfg &log_cfg)
     LOG_ERROR("init ObScheduleSuspectInfoMgr failed", KR(ret));
   } else if (OB_FAIL(compaction::ObCompactionSuggestionMgr::get_instance().init())) {
     LOG_ERROR("init ObCompactionSuggestionMgr failed", KR(ret));
+  } else if (OB_FAIL(ObMicroBlockCompressPool::get_instance().init())) {
+    LOG_ERROR("init ObMicroBlockCompressPool failed", KR(ret));
   } else if (OB_FAIL(G_RES_MGR.init())) {
     LOG_ERROR("failed to init resource plan", KR(ret));
 #ifdef ENABLE_IMC
@@ -476,6 +479,10 @@ void ObServer::destroy()
     compaction::ObScheduleSuspectInfoMgr::get_instance().destroy();
     FLOG_INFO("ObScheduleSuspectInfoMgr destroyed");
 
+    FLOG_INFO("begin to destroy ObMicroBlockCompressPool");
+    ObMicroBlockCompressPool::get_instance().destroy();
+    FLOG_INFO("ObMicroBlockCompressPool destroyed");
+
     FLOG_INFO("begin to destroy location service");
     location_service_.destroy();
     FLOG_INFO("location service destroyed");
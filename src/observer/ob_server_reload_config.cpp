@@ -15,8 +15,10 @@
 #include "ob_server_reload_config.h"
 #include "lib/alloc/alloc_func.h"
 #include "lib/alloc/ob_malloc_allocator.h"
+#include "lib/alloc/object_mgr.h"
 #include "lib/allocator/ob_tc_malloc.h"
 #include "lib/allocator/ob_mem_leak_checker.h"
+#include "lib/allocator/ob_mem_sample_profiler.h"
 #include "share/scheduler/ob_dag_scheduler.h"
 #include "rpc/obrpc/ob_rpc_handler.h"
 #include "share/ob_cluster_version.h"
@@ -157,6 +159,7 @@ int ObServerReloadConfig::operator()()
 
     (void)reload_diagnose_info_config(GCONF.enable_perf_event);
     (void)reload_trace_log_config(GCONF.enable_record_trace_log);
+    (void)reload_wait_event_sample_config(GCONF._wait_event_sample_interval);
 
     reload_tenant_freezer_config_();
     reload_tenant_scheduler_config_();
@@ -174,6 +177,12 @@ int ObServerReloadConfig::operator()()
   const int64_t cache_size = GCONF.memory_chunk_cache_size;
   const int cache_cnt = (cache_size > 0 ? cache_size : GCONF.get_server_memory_limit()) / INTACT_ACHUNK_SIZE;
   lib::AChunkMgr::instance().set_max_chunk_cache_cnt(cache_cnt);
+  ObMemSampleProfiler::get_instance().set_interval(GCONF._memory_sample_interval);
+  lib::ObjectThreadCache::set_enabled(GCONF._enable_object_thread_cache);
+  if (!GCONF._enable_object_thread_cache) {
+    // frees stop filling the caches, give back what they still hold
+    ObMallocAllocator::get_instance()->flush_object_thread_cache();
+  }
   if (GCONF.cluster_id.get_value() >= 0) {
     obrpc::ObRpcNetHandler::CLUSTER_ID = GCONF.cluster_id.get_value();
     LOG_INFO("set CLUSTER_ID for rpc", "cluster_id", GCONF.cluster_id.get_value());
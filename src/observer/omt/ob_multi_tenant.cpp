@@ -42,6 +42,7 @@
 #include "share/stat/ob_opt_stat_monitor_manager.h"
 #include "share/ob_global_autoinc_service.h"
 #include "lib/thread/ob_thread_name.h"
+#include "lib/cpu/ob_cpu_topology.h"
 #include "logservice/ob_log_service.h"
 #include "logservice/archiveservice/ob_archive_service.h"    // ObArchiveService
 #include "ob_tenant_mtl_helper.h"
@@ -946,11 +947,41 @@ int ObMultiTenant::update_tenant_config(uint64_t tenant_id)
         LOG_WARN("failed to update tenant dag scheduler config", K(tmp_ret), K(tenant_id));
       }
     }
+    if (OB_SUCCESS != (tmp_ret = update_tenant_numa_node(tenant_id, tenant_config))) {
+      LOG_WARN("failed to update tenant numa node", K(tmp_ret), K(tenant_id));
+    }
   }
   LOG_INFO("update_tenant_config success", K(tenant_id));
   return ret;
 }
 
+int ObMultiTenant::update_tenant_numa_node(const uint64_t tenant_id, ObTenantConfigGuard &tenant_config)
+{
+  int ret = OB_SUCCESS;
+  ObTenant *tenant = nullptr;
+  int64_t numa_node = tenant_config->_tenant_numa_node;
+  if (OB_FAIL(get_tenant(tenant_id, tenant))) {
+    LOG_WARN("get tenant failed", K(ret), K(tenant_id));
+  } else if (OB_ISNULL(tenant)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("tenant is NULL", K(ret), K(tenant_id));
+  } else {
+    if (numa_node < 0) {
+      numa_node = -1;
+    } else if (!is_numa_node_bindable(numa_node)) {
+      LOG_WARN("numa node not exist or has no usable cpu, keep tenant workers unbound",
+               K(tenant_id), K(numa_node), "numa_node_count", get_numa_node_count());
+      numa_node = -1;
+    }
+    if (numa_node != tenant->numa_node()) {
+      // workers rebind themselves before their next request
+      tenant->set_numa_node(numa_node);
+      LOG_INFO("update tenant numa node", K(tenant_id), K(numa_node));
+    }
+  }
+  return ret;
+}
+
 int ObMultiTenant::update_palf_disk_config(ObTenantConfigGuard &tenant_config)
 {
   int ret = OB_SUCCESS;
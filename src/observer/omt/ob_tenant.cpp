@@ -529,6 +529,7 @@ ObTenant::ObTenant(const int64_t id,
       last_calibrate_token_ts_(0),
       last_pop_normal_cnt_(0),
       nesting_worker_has_init_(MULTI_LEVEL_THRESHOLD),
+      numa_node_(-1),
       stopped_(true),
       wait_mtl_finished_(false),
       req_queue_(),
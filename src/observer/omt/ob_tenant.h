@@ -432,6 +432,9 @@ public:
   double unit_min_cpu() const;
   void set_token(const int64_t token);
   void set_sug_token(const int64_t token);
+  // numa node the tenant workers are bound to, -1 if not bound
+  void set_numa_node(const int64_t numa_node);
+  int64_t numa_node() const;
   int64_t token_cnt() const;
   int64_t sug_token_cnt() const;
   lib::Worker::CompatMode get_compat_mode() const;
@@ -472,6 +475,7 @@ public:
                K_(tenant_meta),
                K_(unit_min_cpu), K_(unit_max_cpu), K_(slice),
                K_(slice_remain), K_(token_cnt), K_(sug_token_cnt),
+               K_(numa_node),
                K_(ass_token_cnt),
                K_(lq_tokens),
                K_(used_lq_tokens),
@@ -603,6 +607,7 @@ protected:
   int64_t last_calibrate_token_ts_;
   int64_t last_pop_normal_cnt_;
   int nesting_worker_has_init_;
+  int64_t numa_node_;
 
   bool stopped_;
   bool wait_mtl_finished_;
@@ -706,6 +711,16 @@ inline int64_t ObTenant::sug_token_cnt() const
   return sug_token_cnt_;
 }
 
+inline void ObTenant::set_numa_node(const int64_t numa_node)
+{
+  ATOMIC_STORE(&numa_node_, numa_node);
+}
+
+inline int64_t ObTenant::numa_node() const
+{
+  return ATOMIC_LOAD(&numa_node_);
+}
+
 inline void ObTenant::add_idle_time(int64_t idle_time)
 {
   (void)ATOMIC_FAA(reinterpret_cast<uint64_t *>(&idle_us_), idle_time);
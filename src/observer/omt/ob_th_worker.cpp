@@ -21,6 +21,7 @@
 #include "lib/allocator/ob_page_manager.h"
 #include "lib/rc/context.h"
 #include "lib/thread/ob_thread_name.h"
+#include "lib/cpu/ob_cpu_topology.h"
 #include "ob_tenant.h"
 #include "ob_worker_processor.h"
 #include "share/config/ob_server_config.h"
@@ -380,6 +381,10 @@ void ObThWorker::worker(int64_t &tenant_id, int64_t &req_recv_timestamp, int32_t
           GCTX.cgroup_ctrl_->add_thread_to_cgroup(get_tid(), tenant_->id(), get_group_id());
           has_add_to_cgroup_ = true;
         }
+        if (OB_UNLIKELY(tenant_->numa_node() != get_thread_numa_node())) {
+          // the tenant is bound to another numa node or the worker served another tenant
+          IGNORE_RETURN bind_thread_to_numa_node(tenant_->numa_node());
+        }
         if (OB_LIKELY(pm != nullptr)) {
           if (pm->get_used() != 0) {
             LOG_ERROR("page manager's used should be 0, unexpected!!!", KP(pm));
@@ -11,6 +11,7 @@
  */
 
 #include "observer/virtual_table/ob_all_virtual_session_wait.h"
+#include "lib/time/ob_tsc_timestamp.h"
 
 using namespace oceanbase::common;
 
@@ -130,7 +131,7 @@ int ObAllVirtualSessionWait::inner_get_next_row(ObNewRow *&row)
         SERVER_LOG(WARN, "event_desc or collect_ is NULL", K(ret), KP(event_desc), KP(collect_));
       }
       uint64_t cell_idx = 0;
-      int64_t curr_time = ObTimeUtility::current_time();
+      int64_t curr_time = OB_TSC_TIMESTAMP.current_time();
       for (int64_t i = 0; OB_SUCC(ret) && i < col_count; ++i) {
         uint64_t col_id = output_column_ids_.at(i);
         switch(col_id) {
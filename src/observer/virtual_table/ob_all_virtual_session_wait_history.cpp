@@ -11,6 +11,7 @@
  */
 
 #include "observer/virtual_table/ob_all_virtual_session_wait_history.h"
+#include "lib/time/ob_tsc_timestamp.h"
 
 using namespace oceanbase::common;
 
@@ -153,7 +154,7 @@ int ObAllVirtualSessionWaitHistory::inner_get_next_row(ObNewRow *&row)
       }
       uint64_t cell_idx = 0;
       double value = 0;
-      int64_t curr_time = ObTimeUtility::current_time();
+      int64_t curr_time = OB_TSC_TIMESTAMP.current_time();
       for (int64_t i = 0; OB_SUCC(ret) && i < col_count; ++i) {
         uint64_t col_id = output_column_ids_.at(i);
         switch(col_id) {
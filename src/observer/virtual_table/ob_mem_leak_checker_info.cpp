@@ -12,6 +12,7 @@
 
 #include "ob_mem_leak_checker_info.h"
 #include "lib/allocator/ob_mem_leak_checker.h"
+#include "lib/utility/utility.h"
 #include "common/object/ob_object.h"
 #include "share/config/ob_server_config.h"
 
@@ -26,7 +27,10 @@ ObMemLeakCheckerInfo::ObMemLeakCheckerInfo()
   : ObVirtualTableIterator(),
     opened_(false),
     addr_(NULL),
-    tenant_id_(-1)
+    tenant_id_(-1),
+    samples_(NULL),
+    sample_cnt_(0),
+    sample_idx_(0)
 {
   leak_checker_ = &get_mem_leak_checker();
   label_ = leak_checker_->get_str();
@@ -44,6 +48,9 @@ void ObMemLeakCheckerInfo::reset()
   addr_ = NULL;
   tenant_id_ = -1;
   label_ = nullptr;
+  samples_ = NULL;
+  sample_cnt_ = 0;
+  sample_idx_ = 0;
 }
 
 int ObMemLeakCheckerInfo::sanity_check()
@@ -67,6 +74,8 @@ int ObMemLeakCheckerInfo::inner_get_next_row(common::ObNewRow *&row)
       SERVER_LOG(WARN, "failed to create hashmap", K(ret));
     } else if (OB_FAIL(leak_checker_->load_leak_info_map(info_map_))) {
       SERVER_LOG(WARN, "failed to collection leak info", K(ret));
+    } else if (OB_FAIL(load_samples())) {
+      SERVER_LOG(WARN, "failed to load memory samples", K(ret));
     } else {
       opened_ = true;
       it_ = info_map_.begin();
@@ -75,10 +84,16 @@ int ObMemLeakCheckerInfo::inner_get_next_row(common::ObNewRow *&row)
 
   if (OB_SUCC(ret)) {
     if (it_ != info_map_.end()) {
-      if (OB_FAIL(fill_row(row))) {
+      if (OB_FAIL(fill_row(label_, "user", it_->second.first, it_->second.second,
+                           it_->first.bt_, row))) {
         SERVER_LOG(WARN, "failed to fill row", K(ret));
       }
       it_++;
+    } else if (sample_idx_ < sample_cnt_) {
+      if (OB_FAIL(fill_sample_row(samples_[sample_idx_], row))) {
+        SERVER_LOG(WARN, "failed to fill sample row", K(ret));
+      }
+      sample_idx_++;
     } else {
       ret = OB_ITER_END;
     }
@@ -87,7 +102,57 @@ int ObMemLeakCheckerInfo::inner_get_next_row(common::ObNewRow *&row)
   return ret;
 }
 
-int ObMemLeakCheckerInfo::fill_row(common::ObNewRow *&row)
+int ObMemLeakCheckerInfo::load_samples()
+{
+  int ret = OB_SUCCESS;
+  ObMemSampleProfiler &profiler = ObMemSampleProfiler::get_instance();
+  int64_t count = 0;
+  int64_t interval = 0;
+  sample_cnt_ = 0;
+  sample_idx_ = 0;
+  if (0 == profiler.get_interval()) {
+    // sampling is off, skip the copy of the table
+  } else if (OB_ISNULL(samples_ = static_cast<ObMemSampleProfiler::Bucket *>(
+      allocator_->alloc(sizeof(ObMemSampleProfiler::Bucket) * ObMemSampleProfiler::BUCKET_COUNT)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    SERVER_LOG(WARN, "failed to alloc samples", K(ret));
+  } else if (OB_FAIL(profiler.snapshot(samples_, count, interval))) {
+    SERVER_LOG(WARN, "failed to snapshot memory samples", K(ret));
+  } else {
+    // user tenants only see their own allocations
+    for (int64_t i = 0; i < count; ++i) {
+      if (is_sys_tenant(tenant_id_) || samples_[i].tenant_id_ == tenant_id_) {
+        samples_[sample_cnt_++] = samples_[i];
+      }
+    }
+  }
+  return ret;
+}
+
+int ObMemLeakCheckerInfo::fill_sample_row(const ObMemSampleProfiler::Bucket &sample,
+                                          common::ObNewRow *&row)
+{
+  int ret = OB_SUCCESS;
+  const int64_t mod_name_len = sizeof(sample.label_) + 32;
+  const int64_t bt_len = ObMemSampleProfiler::MAX_STACK_DEPTH * 20;
+  char *mod_name = NULL;
+  char *bt = NULL;
+  if (OB_ISNULL(mod_name = static_cast<char *>(allocator_->alloc(mod_name_len)))
+      || OB_ISNULL(bt = static_cast<char *>(allocator_->alloc(bt_len)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    SERVER_LOG(WARN, "failed to alloc buffer", K(ret));
+  } else {
+    // mod_name is label@tenant, alloc_count and alloc_size are unsampled estimates
+    snprintf(mod_name, mod_name_len, "%s@%lu", sample.label_, sample.tenant_id_);
+    parray(bt, bt_len, (int64_t *)sample.stack_, static_cast<int>(sample.depth_));
+    ret = fill_row(mod_name, "sample", sample.get_est_count(), sample.get_est_bytes(), bt, row);
+  }
+  return ret;
+}
+
+int ObMemLeakCheckerInfo::fill_row(const char *mod_name, const char *mod_type,
+                                   const int64_t alloc_count, const int64_t alloc_size,
+                                   const char *back_trace, common::ObNewRow *&row)
 {
   int ret = OB_SUCCESS;
   const int64_t col_count = output_column_ids_.count();
@@ -127,25 +192,25 @@ int ObMemLeakCheckerInfo::fill_row(common::ObNewRow *&row)
       } break;
       case 18: {
         //mod_name
-        cells[i].set_varchar(label_);
+        cells[i].set_varchar(mod_name);
         cells[i].set_collation_type(ObCharset::get_default_collation(ObCharset::get_default_charset()));
       } break;
       case 19: {
         //mod_type
-        cells[i].set_varchar(ObString::make_string("user"));
+        cells[i].set_varchar(ObString::make_string(mod_type));
         cells[i].set_collation_type(ObCharset::get_default_collation(ObCharset::get_default_charset()));
       } break;
       case 20: {
         // alloc_count
-        cells[i].set_int(it_->second.first);
+        cells[i].set_int(alloc_count);
       } break;
       case 21: {
         // alloc_size
-        cells[i].set_int(it_->second.second);
+        cells[i].set_int(alloc_size);
       } break;
       case 22: {
         // back_trace
-        cells[i].set_varchar(it_->first.bt_);
+        cells[i].set_varchar(back_trace);
         cells[i].set_collation_type(ObCharset::get_default_collation(ObCharset::get_default_charset()));
       } break;
 
@@ -16,6 +16,7 @@
 #include "share/ob_define.h"
 #include "lib/net/ob_addr.h"
 #include "lib/allocator/ob_mem_leak_checker.h"
+#include "lib/allocator/ob_mem_sample_profiler.h"
 
 #include "share/ob_virtual_table_iterator.h"
 #include "share/ob_scanner.h"
@@ -42,7 +43,10 @@ public:
   virtual void reset();
 private:
   int sanity_check();
-  int fill_row(common::ObNewRow *&row);
+  int load_samples();
+  int fill_row(const char *mod_name, const char *mod_type, const int64_t alloc_count,
+               const int64_t alloc_size, const char *back_trace, common::ObNewRow *&row);
+  int fill_sample_row(const common::ObMemSampleProfiler::Bucket &sample, common::ObNewRow *&row);
 private:
   bool opened_;
   common::ObMemLeakChecker *leak_checker_;
@@ -51,6 +55,10 @@ private:
   common::ObAddr *addr_;
   uint64_t tenant_id_;
   const char *label_;
+  // rows of the sample profiler follow the ones of the leak checker
+  common::ObMemSampleProfiler::Bucket *samples_;
+  int64_t sample_cnt_;
+  int64_t sample_idx_;
 private:
   DISALLOW_COPY_AND_ASSIGN(ObMemLeakCheckerInfo);
 };
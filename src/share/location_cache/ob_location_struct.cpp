@@ -994,5 +994,7 @@ int ObLocationSem::release()
   return ret;
 }
 
+int64_t ObLocationCacheVersion::version_ = 0;
+
 } // end namespace share
 } // end namespace oceanbase
@@ -358,6 +358,17 @@ private:
   common::ObThreadCond cond_;
 };
 
+// Bumped whenever a cached tablet->ls mapping or ls location is changed or removed,
+// lets callers memoize location lookups and validate them with a single load.
+class ObLocationCacheVersion
+{
+public:
+  static int64_t get() { return ATOMIC_LOAD(&version_); }
+  static void inc() { ATOMIC_INC(&version_); }
+private:
+  static int64_t version_;
+};
+
 } // end namespace share
 } // end namespace oceanbase
 #endif
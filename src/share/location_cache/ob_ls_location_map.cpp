@@ -131,8 +131,14 @@ int ObLSLocationMap::update(
         ls_buckets_[pos] = tmp;
         ATOMIC_INC(&size_);
       }
-    } else if (OB_FAIL(curr->deep_copy(ls_location))) { // update
-      LOG_WARN("ls location deep copy error", KR(ret), K(ls_location));
+    } else {
+      // update
+      const bool replica_changed = !curr->is_same_with(ls_location);
+      if (OB_FAIL(curr->deep_copy(ls_location))) {
+        LOG_WARN("ls location deep copy error", KR(ret), K(ls_location));
+      } else if (replica_changed) {
+        ObLocationCacheVersion::inc();
+      }
     }
   }
 
@@ -211,6 +217,7 @@ int ObLSLocationMap::del(const ObLSLocationCacheKey &key)
       ls_location->next_ = NULL;
       op_free(ls_location);
       ATOMIC_DEC(&size_);
+      ObLocationCacheVersion::inc();
     }
   }
 
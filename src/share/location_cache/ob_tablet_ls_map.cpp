@@ -135,10 +135,14 @@ int ObTabletLSMap::update(const ObTabletLSCache &tablet_ls_cache)
       }
     } else {
       // update
+      const bool ls_changed = curr->get_ls_id() != tablet_ls_cache.get_ls_id();
       if (OB_FAIL(curr->assign(tablet_ls_cache))) {
         LOG_WARN("fail to assign tablet_ls_cache", KR(ret), K(tablet_ls_cache));
       } else {
         try_update_access_ts_(curr); // always update for update
+        if (ls_changed) {
+          ObLocationCacheVersion::inc();
+        }
       }
     }
   }
@@ -235,6 +239,7 @@ int ObTabletLSMap::del(const ObTabletLSKey &key)
       tablet_ls_cache->next_ = NULL;
       op_free(tablet_ls_cache);
       ATOMIC_DEC(&size_);
+      ObLocationCacheVersion::inc();
     }
   }
 
@@ -191,9 +191,17 @@ class ObVTableScanParam
 {
 public:
 
-ObVTableScanParam() :
+  ObVTableScanParam() : ObVTableScanParam(NULL) {}
+  // @array_arena: arena of the request owning this param, column ids and
+  // ranges which spill out of the local buffers are taken from it and released
+  // together with it, instead of going through ob_malloc/ob_free on every query.
+  // NULL keeps them on ob_malloc for params which outlive the request.
+  explicit ObVTableScanParam(ObIAllocator *array_arena) :
       tenant_id_(OB_INVALID_ID),
+      column_ids_(OB_MALLOC_NORMAL_BLOCK_SIZE, array_allocator(array_arena)),
       index_id_(OB_INVALID_ID),
+      key_ranges_(OB_MALLOC_NORMAL_BLOCK_SIZE, array_allocator(array_arena)),
+      range_array_pos_(OB_MALLOC_NORMAL_BLOCK_SIZE, array_allocator(array_arena)),
       timeout_(-1),
       sql_mode_(SMO_DEFAULT),
       reserved_cell_count_(-1),
@@ -317,10 +325,20 @@ ObVTableScanParam() :
     call_dtor(schema_guard_);
   }
   DECLARE_VIRTUAL_TO_STRING;
+private:
+  static ModulePageAllocator array_allocator(ObIAllocator *array_arena)
+  {
+    ModulePageAllocator allocator(ObModIds::OB_SE_ARRAY);
+    allocator.set_allocator(array_arena);
+    return allocator;
+  }
 private:
   // New schema, used throughout the life cycle of table_scan
   share::schema::ObSchemaGetterGuard *schema_guard_;
   char schema_guard_buf_[sizeof(share::schema::ObSchemaGetterGuard)];
+  // the arrays may be bound to the arena of the request, a copy would keep
+  // pointing to it after the request is gone, use assign() on them instead
+  DISALLOW_COPY_AND_ASSIGN(ObVTableScanParam);
 };
 
 class ObITabletScan
@@ -133,6 +133,10 @@ DEF_TIME(dead_socket_detection_timeout, OB_CLUSTER_PARAMETER, "3s", "[0s,2h]",
 DEF_BOOL(enable_perf_event, OB_CLUSTER_PARAMETER, "True",
          "specifies whether to enable perf event feature. The default value is True.",
          ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_INT(_wait_event_sample_interval, OB_CLUSTER_PARAMETER, "1", "[1, 1024]",
+        "time one out of every N waits recorded without a session and scale the waited time by N. "
+        "The wait count stays exact. 1 means every wait is timed. Range: [1, 1024]",
+        ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 DEF_BOOL(enable_upgrade_mode, OB_CLUSTER_PARAMETER, "False",
          "specifies whether upgrade mode is turned on. "
          "If turned on, daily merger and balancer will be disabled. "
@@ -211,6 +215,14 @@ DEF_CAP(cache_wash_threshold, OB_CLUSTER_PARAMETER, "4GB", "[0B,]",
         ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 DEF_CAP(memory_chunk_cache_size, OB_CLUSTER_PARAMETER, "0M", "[0M,]", "the maximum size of memory cached by memory chunk cache. Range: [0M,], 0 stands for adaptive",
         ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_CAP(_memory_sample_interval, OB_CLUSTER_PARAMETER, "0M", "[0M,]",
+        "the average size of memory allocated between two samples of the memory sample profiler, "
+        "0 disables sampling. Range: [0M,]",
+        ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_BOOL(_enable_object_thread_cache, OB_CLUSTER_PARAMETER, "False",
+         "specifies whether small objects freed by a thread are cached for its next allocations. "
+         "Value: True:turned on;  False: turned off",
+         ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 DEF_TIME(autoinc_cache_refresh_interval, OB_CLUSTER_PARAMETER, "3600s", "[100ms,]",
          "auto-increment service cache refresh sync_value in this interval, "
          "with default 3600s. Range: [100ms, +∞)",
@@ -290,6 +302,10 @@ DEF_INT(_ob_max_thread_num, OB_CLUSTER_PARAMETER, "0", "[0,10000)",
 DEF_DBL(cpu_quota_concurrency, OB_TENANT_PARAMETER, "4", "[1,10]",
         "max allowed concurrency for 1 CPU quota. Range: [1,10]",
         ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_INT(_tenant_numa_node, OB_TENANT_PARAMETER, "-1", "[-1,7]",
+        "the NUMA node the tenant workers are bound to, their chunks are then mapped from "
+        "and cached for that node. -1 means not bound. Range: [-1, 7]",
+        ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 DEF_DBL(token_reserved_percentage, OB_CLUSTER_PARAMETER,
         "30", "[0,100]",
         "specifies the amount of token increase allocated to a tenant based on "
@@ -772,6 +788,16 @@ DEF_BOOL(_enable_compaction_diagnose, OB_CLUSTER_PARAMETER, "False",
          "enable compaction diagnose function"
          "Value:  True:turned on;  False: turned off",
          ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_BOOL(_enable_parallel_micro_block_compress, OB_CLUSTER_PARAMETER, "False",
+         "specifies whether micro blocks are compressed and checksummed on a helper thread pool "
+         "while the merge thread encodes the next micro block. "
+         "Value:  True:turned on;  False: turned off",
+         ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_BOOL(_enable_decoded_column_cache, OB_CLUSTER_PARAMETER, "False",
+         "specifies whether vectorized scans keep decoded column vectors of encoded micro blocks "
+         "in the decoded_column_cache and serve later scans of the same blocks from it. "
+         "Value:  True:turned on;  False: turned off",
+         ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 DEF_STR(_force_skip_encoding_partition_id, OB_CLUSTER_PARAMETER, "",
         "force the specified partition to major without encoding row store, only for emergency!",
         ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
@@ -703,26 +703,74 @@ int ObDASLocationRouter::get_tablet_loc(const ObDASTableLocMeta &loc_meta,
   return ret;
 }
 
+// Per worker memo of tablet -> (ls, leader) resolved by get_leader.
+// Repeated executions of a cached plan on the same tablets skip both location
+// map lookups (bucket lock plus ObLSLocation deep copy), an entry is only trusted
+// while ObLocationCacheVersion is unchanged since it was resolved.
+struct ObDASLeaderMemo
+{
+  static const int64_t ENTRY_CNT = 64;
+  struct Entry
+  {
+    Entry() : tenant_id_(OB_INVALID_TENANT_ID), tablet_id_(), version_(-1), ls_id_(), leader_() {}
+    uint64_t tenant_id_;
+    ObTabletID tablet_id_;
+    int64_t version_;
+    ObLSID ls_id_;
+    ObAddr leader_;
+  };
+  static Entry &get_entry(const uint64_t tenant_id, const ObTabletID &tablet_id)
+  {
+    static thread_local Entry entries[ENTRY_CNT];
+    return entries[(tablet_id.id() ^ tenant_id) % ENTRY_CNT];
+  }
+  static bool fetch(const uint64_t tenant_id,
+                    const ObTabletID &tablet_id,
+                    const int64_t expire_renew_time,
+                    ObLSID &ls_id,
+                    ObAddr &leader)
+  {
+    bool bret = false;
+    if (INT64_MAX != expire_renew_time) {
+      const Entry &entry = get_entry(tenant_id, tablet_id);
+      if (entry.tenant_id_ == tenant_id
+          && entry.tablet_id_ == tablet_id
+          && entry.version_ == ObLocationCacheVersion::get()) {
+        ls_id = entry.ls_id_;
+        leader = entry.leader_;
+        bret = true;
+      }
+    }
+    return bret;
+  }
+  static void store(const uint64_t tenant_id,
+                    const ObTabletID &tablet_id,
+                    const int64_t version,
+                    const ObLSID &ls_id,
+                    const ObAddr &leader)
+  {
+    Entry &entry = get_entry(tenant_id, tablet_id);
+    entry.tenant_id_ = tenant_id;
+    entry.tablet_id_ = tablet_id;
+    entry.version_ = version;
+    entry.ls_id_ = ls_id;
+    entry.leader_ = leader;
+  }
+};
+
 int ObDASLocationRouter::get_leader(const uint64_t tenant_id,
                                     const ObTabletID &tablet_id,
                                     ObDASTabletLoc &tablet_loc,
                                     int64_t expire_renew_time)
 {
   int ret = OB_SUCCESS;
-  bool is_cache_hit = false;
   tablet_loc.tablet_id_ = tablet_id;
-  if (OB_FAIL(GCTX.location_service_->get(tenant_id,
-                                          tablet_id,
-                                          expire_renew_time,
-                                          is_cache_hit,
-                                          tablet_loc.ls_id_))) {
-    LOG_WARN("nonblock get ls id failed", K(ret));
-  } else if (OB_FAIL(GCTX.location_service_->get_leader(GCONF.cluster_id,
-                                                        tenant_id,
-                                                        tablet_loc.ls_id_,
-                                                        false,
-                                                        tablet_loc.server_))) {
-    LOG_WARN("nonblock get ls location failed", K(ret));
+  if (OB_FAIL(get_leader(tenant_id,
+                         tablet_id,
+                         tablet_loc.ls_id_,
+                         tablet_loc.server_,
+                         expire_renew_time))) {
+    LOG_WARN("get leader failed", K(ret), K(tenant_id), K(tablet_id));
   }
   return ret;
 }
@@ -731,15 +779,28 @@ int ObDASLocationRouter::get_leader(const uint64_t tenant_id,
                                     const ObTabletID &tablet_id,
                                     ObAddr &leader_addr,
                                     int64_t expire_renew_time)
+{
+  ObLSID ls_id;
+  return get_leader(tenant_id, tablet_id, ls_id, leader_addr, expire_renew_time);
+}
+
+int ObDASLocationRouter::get_leader(const uint64_t tenant_id,
+                                    const ObTabletID &tablet_id,
+                                    ObLSID &ls_id,
+                                    ObAddr &leader_addr,
+                                    int64_t expire_renew_time)
 {
   int ret = OB_SUCCESS;
   bool is_cache_hit = false;
-  ObLSID ls_id;
-  if (OB_FAIL(GCTX.location_service_->get(tenant_id,
-                                          tablet_id,
-                                          expire_renew_time,
-                                          is_cache_hit,
-                                          ls_id))) {
+  // read the version before resolving, a concurrent change makes the stored entry stale at once
+  const int64_t version = ObLocationCacheVersion::get();
+  if (ObDASLeaderMemo::fetch(tenant_id, tablet_id, expire_renew_time, ls_id, leader_addr)) {
+    // hit, location maps untouched
+  } else if (OB_FAIL(GCTX.location_service_->get(tenant_id,
+                                                 tablet_id,
+                                                 expire_renew_time,
+                                                 is_cache_hit,
+                                                 ls_id))) {
     LOG_WARN("nonblock get ls id failed", K(ret));
   } else if (OB_FAIL(GCTX.location_service_->get_leader(GCONF.cluster_id,
                                                         tenant_id,
@@ -747,6 +808,8 @@ int ObDASLocationRouter::get_leader(const uint64_t tenant_id,
                                                         false,
                                                         leader_addr))) {
     LOG_WARN("nonblock get ls location failed", K(ret));
+  } else {
+    ObDASLeaderMemo::store(tenant_id, tablet_id, version, ls_id, leader_addr);
   }
   return ret;
 }
@@ -229,6 +229,11 @@ public:
                               const ObDASTabletLoc &tablet_loc,
                               share::ObLSReplicaLocation &replica_loc);
 private:
+  static int get_leader(const uint64_t tenant_id,
+                        const common::ObTabletID &tablet_id,
+                        share::ObLSID &ls_id,
+                        ObAddr &leader_addr,
+                        int64_t expire_renew_time);
   int get_vt_svr_pair(uint64_t vt_id, const VirtualSvrPair *&vt_svr_pair);
   int get_vt_tablet_loc(uint64_t table_id,
                         const common::ObTabletID &tablet_id,
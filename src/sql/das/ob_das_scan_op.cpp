@@ -147,7 +147,8 @@ int ObDASScanRtDef::init_pd_op(ObExecContext &exec_ctx,
 
 ObDASScanOp::ObDASScanOp(ObIAllocator &op_alloc)
   : ObIDASTaskOp(op_alloc),
-    scan_param_(),
+    // the op is destroyed by the das factory before op_alloc is reused
+    scan_param_(&op_alloc),
     scan_ctdef_(nullptr),
     scan_rtdef_(nullptr),
     result_(nullptr),
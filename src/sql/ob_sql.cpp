@@ -2994,11 +2994,29 @@ int ObSql::pc_get_plan(ObPlanCacheCtx &pc_ctx,
       if (OB_SUCC(ret) && !pc_ctx.sql_ctx_.is_remote_sql_ && GCONF.enable_perf_event) {
         //如果是remote sql第二次重入plan cache，不需要再做权限检查，因为在第一次进入plan cache已经检查过了
         if (!ObSchemaChecker::is_ora_priv_check()) {
-          if (OB_FAIL(ObPrivilegeCheck::check_privilege(
+          // the privilege check result only depends on the plan, the privilege state of
+          // the session and the schema, remember it to keep the hit path short. A check
+          // with the privilege check flag of the sql ctx changed proves nothing.
+          ObSQLSessionInfo::ObCachedPlanPrivInfo &priv_info = session->get_cached_plan_priv_info();
+          const bool use_priv_memo =
+              PRIV_CHECK_FLAG_NORMAL == pc_ctx.sql_ctx_.disable_privilege_check_;
+          int64_t schema_version = OB_INVALID_VERSION;
+          if (use_priv_memo && OB_FAIL(pc_ctx.sql_ctx_.schema_guard_->get_schema_version(
+                      session->get_priv_tenant_id(), schema_version))) {
+            LOG_WARN("fail to get schema version", K(ret));
+          } else if (use_priv_memo
+                     && priv_info.is_checked(*session, plan->get_plan_id(), schema_version)) {
+            NG_TRACE(check_priv);
+          } else if (OB_FAIL(ObPrivilegeCheck::check_privilege(
                                           pc_ctx.sql_ctx_,
                                           plan->get_stmt_need_privs()))) {
             LOG_WARN("No privilege", K(ret), "stmt_need_priv", plan->get_stmt_need_privs());
           } else {
+            int tmp_ret = OB_SUCCESS;
+            if (use_priv_memo && OB_SUCCESS != (tmp_ret = priv_info.set_checked(
+                        *session, plan->get_plan_id(), schema_version))) {
+              LOG_WARN("fail to remember privilege check", K(tmp_ret));
+            }
             LOG_DEBUG("cached phy plan", K(*plan));
             NG_TRACE(check_priv);
           }
@@ -243,6 +243,7 @@ void ObSqlCtx::reset()
   multi_stmt_item_.reset();
   session_info_ = NULL;
   schema_guard_ = NULL;
+  secondary_namespace_ = NULL;
   plan_cache_hit_ = false;
   self_add_plan_ = false;
   disable_privilege_check_ = PRIV_CHECK_FLAG_NORMAL;
@@ -256,7 +257,11 @@ void ObSqlCtx::reset()
   is_pre_execute_ = false;
   is_prepare_stage_ = false;
   is_dynamic_sql_ = false;
+  is_dbms_sql_ = false;
+  is_cursor_ = false;
   is_remote_sql_ = false;
+  statement_id_ = common::OB_INVALID_ID;
+  cur_sql_.reset();
   is_restore_ = false;
   need_late_compile_ = false;
   all_plan_const_param_constraints_ = nullptr;
@@ -273,6 +278,7 @@ void ObSqlCtx::reset()
     reroute_info_ = nullptr;
   }
   clear();
+  spm_ctx_.reset();
   flashback_query_expr_ = nullptr;
   stmt_type_ = stmt::T_NONE;
   cur_plan_ = nullptr;
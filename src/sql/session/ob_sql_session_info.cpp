@@ -305,6 +305,7 @@ void ObSQLSessionInfo::reset(bool skip_sys_var)
     ObBasicSessionInfo::reset(skip_sys_var);
     //encrypt_info_.reset();
     cached_schema_guard_info_.reset();
+    cached_plan_priv_info_.reset();
     encrypt_info_.reset();
     enable_role_array_.reset();
     in_definer_named_proc_ = false;
@@ -845,6 +846,87 @@ void ObSQLSessionInfo::get_session_priv_info(share::schema::ObSessionPrivInfo &s
   session_priv.enable_role_id_array_.assign(enable_role_array_);
 }
 
+void ObSQLSessionInfo::ObCachedPlanPrivInfo::reset()
+{
+  MEMSET(plan_ids_, 0, sizeof(plan_ids_));
+  schema_version_ = OB_INVALID_VERSION;
+  priv_tenant_id_ = OB_INVALID_ID;
+  effective_tenant_id_ = OB_INVALID_ID;
+  user_id_ = OB_INVALID_ID;
+  priv_user_id_ = OB_INVALID_ID;
+  user_priv_set_ = OB_PRIV_SET_EMPTY;
+  db_priv_set_ = OB_PRIV_SET_EMPTY;
+  enable_role_array_.reset();
+  db_name_len_ = 0;
+}
+
+// compares everything ObPrivilegeCheck::check_privilege() reads from the session
+bool ObSQLSessionInfo::ObCachedPlanPrivInfo::is_same_state(
+    const ObSQLSessionInfo &session,
+    const int64_t schema_version) const
+{
+  const ObString db_name = session.get_database_name();
+  bool is_same = OB_INVALID_VERSION != schema_version
+      && schema_version == schema_version_
+      && session.get_priv_tenant_id() == priv_tenant_id_
+      && session.get_effective_tenant_id() == effective_tenant_id_
+      && session.get_user_id() == user_id_
+      && session.priv_user_id_ == priv_user_id_
+      && session.user_priv_set_ == user_priv_set_
+      && session.db_priv_set_ == db_priv_set_
+      && session.enable_role_array_.count() == enable_role_array_.count()
+      && db_name.length() == db_name_len_
+      && 0 == MEMCMP(db_name.ptr(), db_name_, db_name_len_);
+  for (int64_t i = 0; is_same && i < enable_role_array_.count(); ++i) {
+    is_same = session.enable_role_array_.at(i) == enable_role_array_.at(i);
+  }
+  return is_same;
+}
+
+bool ObSQLSessionInfo::ObCachedPlanPrivInfo::is_checked(
+    const ObSQLSessionInfo &session,
+    const uint64_t plan_id,
+    const int64_t schema_version) const
+{
+  return 0 != plan_id
+      && plan_id == plan_ids_[plan_id % MAX_PLAN_CNT]
+      && is_same_state(session, schema_version);
+}
+
+int ObSQLSessionInfo::ObCachedPlanPrivInfo::set_checked(
+    const ObSQLSessionInfo &session,
+    const uint64_t plan_id,
+    const int64_t schema_version)
+{
+  int ret = OB_SUCCESS;
+  const ObString db_name = session.get_database_name();
+  if (is_same_state(session, schema_version)) {
+    // do nothing
+  } else if (FALSE_IT(reset())) {
+  } else if (OB_UNLIKELY(db_name.length() > static_cast<int64_t>(sizeof(db_name_)))) {
+    ret = OB_SIZE_OVERFLOW;
+    LOG_WARN("database name is too long", K(ret), K(db_name));
+  } else if (OB_FAIL(enable_role_array_.assign(session.enable_role_array_))) {
+    LOG_WARN("fail to assign enable role array", K(ret));
+  } else {
+    schema_version_ = schema_version;
+    priv_tenant_id_ = session.get_priv_tenant_id();
+    effective_tenant_id_ = session.get_effective_tenant_id();
+    user_id_ = session.get_user_id();
+    priv_user_id_ = session.priv_user_id_;
+    user_priv_set_ = session.user_priv_set_;
+    db_priv_set_ = session.db_priv_set_;
+    MEMCPY(db_name_, db_name.ptr(), db_name.length());
+    db_name_len_ = db_name.length();
+  }
+  if (OB_FAIL(ret)) {
+    reset();
+  } else {
+    plan_ids_[plan_id % MAX_PLAN_CNT] = plan_id;
+  }
+  return ret;
+}
+
 ObPlanCache *ObSQLSessionInfo::get_plan_cache()
 {
   plan_cache_manager_ = GCTX.sql_engine_->get_plan_cache_manager();
@@ -491,6 +491,39 @@ public:
     ObSQLSessionInfo *session_;
   };
 
+  // Plans of the plan cache whose privilege check passed in this session, with the
+  // privilege state they passed under. A plan cache hit of the same plan skips
+  // ObPrivilegeCheck as long as the tenant schema version and every field of that
+  // state are unchanged, any difference drops all remembered plans.
+  class ObCachedPlanPrivInfo
+  {
+  public:
+    ObCachedPlanPrivInfo() { reset(); }
+    ~ObCachedPlanPrivInfo() {}
+    void reset();
+    bool is_checked(const ObSQLSessionInfo &session,
+                    const uint64_t plan_id,
+                    const int64_t schema_version) const;
+    int set_checked(const ObSQLSessionInfo &session,
+                    const uint64_t plan_id,
+                    const int64_t schema_version);
+  private:
+    bool is_same_state(const ObSQLSessionInfo &session, const int64_t schema_version) const;
+  private:
+    static const int64_t MAX_PLAN_CNT = 16;
+    uint64_t plan_ids_[MAX_PLAN_CNT];
+    int64_t schema_version_;
+    uint64_t priv_tenant_id_;
+    uint64_t effective_tenant_id_;
+    uint64_t user_id_;
+    uint64_t priv_user_id_;
+    ObPrivSet user_priv_set_;
+    ObPrivSet db_priv_set_;
+    common::ObSEArray<uint64_t, 8> enable_role_array_;
+    int64_t db_name_len_;
+    char db_name_[common::OB_MAX_DATABASE_NAME_BUF_LENGTH * OB_MAX_CHAR_LEN];
+  };
+
   class ApplicationInfo {
     OB_UNIS_VERSION(1);
   public:
@@ -866,6 +899,7 @@ public:
   void set_table_name_hidden(const bool is_hidden) { is_table_name_hidden_ = is_hidden; }
 
   ObTenantCachedSchemaGuardInfo &get_cached_schema_guard_info() { return cached_schema_guard_info_; }
+  ObCachedPlanPrivInfo &get_cached_plan_priv_info() { return cached_plan_priv_info_; }
   int set_enable_role_array(const common::ObIArray<uint64_t> &role_id_array);
   common::ObIArray<uint64_t>& get_enable_role_array() { return enable_role_array_; }
   void set_in_definer_named_proc(bool in_proc) {in_definer_named_proc_ = in_proc; }
@@ -1065,6 +1099,7 @@ private:
   int xa_last_result_;
   // 为了性能优化考虑，租户级别配置项不需要实时获取，缓存在session上，每隔5s触发一次刷新
   ObCachedTenantConfigInfo cached_tenant_config_info_;
+  ObCachedPlanPrivInfo cached_plan_priv_info_;
   bool prelock_;
   uint64_t proxy_version_;
   uint64_t min_proxy_version_ps_; // proxy大于该版本时，相同sql返回不同的Stmt id
@@ -259,7 +259,29 @@ struct ObSpmCacheCtx : public ObILibCacheCtx
       has_fixed_plan_to_check_(false),
       evolution_plan_type_(OB_PHY_PLAN_UNINITIALIZED),
       last_evolution_count_(0)
-  {}
+  {
+    sql_id_[0] = '\0';
+  }
+  // the cache object held by baseline_guard_ is released by the guard itself
+  void reset()
+  {
+    key_ = NULL;
+    bl_key_.reset();
+    handle_cache_mode_ = MODE_INVALID;
+    plan_hash_value_ = 0;
+    offset_ = -1;
+    need_sync_ = false;
+    is_retry_for_spm_ = false;
+    sql_id_[0] = '\0';
+    capture_baseline_ = false;
+    new_plan_hash_ = 0;
+    spm_stat_ = STAT_INVALID;
+    cache_node_empty_ = true;
+    spm_force_disable_ = false;
+    has_fixed_plan_to_check_ = false;
+    evolution_plan_type_ = OB_PHY_PLAN_UNINITIALIZED;
+    last_evolution_count_ = 0;
+  }
   enum SpmMode {
     MODE_INVALID,
     // for get cache obj
@@ -30,6 +30,7 @@ namespace blocksstable
 {
 struct ObDatumRow;
 class ObIMicroBlockReader;
+class MacroBlockId;
 }
 namespace storage
 {
@@ -58,6 +59,15 @@ public:
       const int64_t end_index,
       const common::ObBitmap *bitmap = nullptr) = 0;
   virtual int reuse_capacity(const int64_t capacity);
+  // identity of the micro block that the following fill_rows calls read from,
+  // data_checksum is only meaningful when has_data_checksum is true
+  virtual void set_micro_block_id(
+      const blocksstable::MacroBlockId &macro_id,
+      const bool has_data_checksum,
+      const int64_t data_checksum)
+  {
+    UNUSEDx(macro_id, has_data_checksum, data_checksum);
+  }
   virtual int filter_micro_block_batch(
       blocksstable::ObMicroBlockDecoder &block_reader,
       sql::ObPushdownFilterExecutor *parent,
@@ -125,8 +125,10 @@ private:
 class ObTableScanParam : public common::ObVTableScanParam
 {
 public:
-  ObTableScanParam()
-      : common::ObVTableScanParam(),
+  ObTableScanParam() : ObTableScanParam(NULL) {}
+  // see ObVTableScanParam, @array_arena must outlive this param
+  explicit ObTableScanParam(common::ObIAllocator *array_arena)
+      : common::ObVTableScanParam(array_arena),
         trans_desc_(NULL),
         snapshot_(),
         tx_id_(),
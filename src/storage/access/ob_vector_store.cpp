@@ -16,6 +16,9 @@
 #include "storage/ob_i_store.h"
 #include "storage/blocksstable/ob_micro_block_reader.h"
 #include "storage/blocksstable/encoding/ob_micro_block_decoder.h"
+#include "storage/blocksstable/ob_storage_cache_suite.h"
+#include "share/config/ob_server_config.h"
+#include "share/rc/ob_tenant_base.h"
 
 namespace oceanbase
 {
@@ -35,7 +38,13 @@ ObVectorStore::ObVectorStore(
     col_params_(*context_.stmt_allocator_),
     map_types_(*context_.stmt_allocator_),
     group_idx_expr_(nullptr),
-    default_row_()
+    default_row_(),
+    enable_decoded_cache_(false),
+    micro_macro_id_(),
+    has_micro_data_checksum_(false),
+    micro_data_checksum_(0),
+    decoded_handle_(),
+    decoded_allocator_("VecDecodedCache")
   {}
 
 ObVectorStore::~ObVectorStore()
@@ -54,12 +63,22 @@ void ObVectorStore::reset()
   map_types_.reset();
   group_idx_expr_ = nullptr;
   default_row_.reset();
+  enable_decoded_cache_ = false;
+  micro_macro_id_.reset();
+  has_micro_data_checksum_ = false;
+  micro_data_checksum_ = 0;
+  decoded_handle_.reset();
+  decoded_allocator_.reset();
 }
 
 void ObVectorStore::reuse()
 {
   ObBlockBatchedRowStore::reuse();
   count_ = 0;
+  micro_macro_id_.reset();
+  has_micro_data_checksum_ = false;
+  micro_data_checksum_ = 0;
+  decoded_handle_.reset();
 }
 
 int ObVectorStore::init(const ObTableAccessParam &param)
@@ -147,6 +166,13 @@ int ObVectorStore::init(const ObTableAccessParam &param)
       }
     }
     default_row_.count_ = col_params_.count();
+    if (OB_SUCC(ret)) {
+      // padded char columns depend on the sql mode, keep them out of the shared cache
+      enable_decoded_cache_ = GCONF._enable_decoded_column_cache && cols_projector_.count() > 0;
+      for (int64_t i = 0; enable_decoded_cache_ && i < col_params_.count(); ++i) {
+        enable_decoded_cache_ = nullptr == col_params_.at(i);
+      }
+    }
   }
   if (OB_FAIL(ret)) {
     reset();
@@ -208,7 +234,11 @@ int ObVectorStore::fill_rows(
     // skip if no rows selected
   } else if (blocksstable::ObIMicroBlockReader::Decoder == reader->get_type()) {
     blocksstable::ObMicroBlockDecoder *block_decoder = static_cast<blocksstable::ObMicroBlockDecoder*>(reader);
-    if (OB_FAIL(block_decoder->get_rows(cols_projector_, col_params_, row_ids_, cell_data_ptrs_, row_capacity, datums_))) {
+    bool filled = false;
+    if (enable_decoded_cache_ && OB_FAIL(fill_rows_from_decoded_cache(*block_decoder, row_capacity, filled))) {
+      LOG_WARN("fail to fill rows from decoded column cache", K(ret), K(row_capacity));
+    } else if (filled) {
+    } else if (OB_FAIL(block_decoder->get_rows(cols_projector_, col_params_, row_ids_, cell_data_ptrs_, row_capacity, datums_))) {
       LOG_WARN("fail to copy rows", K(ret), K(cols_projector_), K(row_capacity),
               "row_ids", common::ObArrayWrap<const int64_t>(row_ids_, row_capacity));
     }
@@ -238,6 +268,136 @@ int ObVectorStore::fill_rows(
   return ret;
 }
 
+int ObVectorStore::fill_rows_from_decoded_cache(
+    blocksstable::ObMicroBlockDecoder &decoder,
+    const int64_t row_capacity,
+    bool &filled)
+{
+  int ret = OB_SUCCESS;
+  filled = false;
+  decoded_handle_.reset();
+  const uint64_t tenant_id = MTL_ID();
+  // without the header data checksum the key would only hold the macro block id and row
+  // count, which other micro blocks of the same macro block share
+  bool can_cache = is_valid_tenant_id(tenant_id)
+      && micro_macro_id_.is_valid()
+      && has_micro_data_checksum_
+      && decoder.row_count() > 0;
+  for (int64_t i = 0; can_cache && i < cols_projector_.count(); ++i) {
+    // columns added after the block was written are filled with defaults by the decoder
+    can_cache = cols_projector_.at(i) >= 0 && cols_projector_.at(i) < decoder.get_column_count();
+  }
+  if (can_cache) {
+    blocksstable::ObDecodedColumnCache &cache = OB_STORE_CACHE.get_decoded_column_cache();
+    const blocksstable::ObDecodedColumnCacheKey key(
+        tenant_id, micro_macro_id_, micro_data_checksum_, decoder.row_count(), cols_projector_);
+    if (OB_FAIL(cache.get_columns(key, decoded_handle_))) {
+      if (OB_UNLIKELY(OB_ENTRY_NOT_EXIST != ret)) {
+        LOG_WARN("fail to get decoded columns", K(ret), K(key));
+      } else if (OB_FAIL(decode_block_to_cache(decoder, key))) {
+        if (OB_ENTRY_EXIST != ret) {
+          LOG_WARN("fail to put decoded columns", K(ret), K(key));
+        }
+      }
+      if (OB_FAIL(ret)) {
+        // the cache is best effort, fall back to decode the requested rows
+        decoded_handle_.reset();
+        ret = OB_SUCCESS;
+      }
+    }
+    if (!decoded_handle_.is_valid()) {
+    } else if (OB_UNLIKELY(decoded_handle_.value_->get_column_cnt() != datums_.count())) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("unexpected decoded column count", K(ret), KPC(decoded_handle_.value_), K(datums_.count()));
+    } else {
+      for (int64_t i = 0; i < datums_.count(); ++i) {
+        sql::ObExpr *expr = exprs_.at(i);
+        const common::ObDatum *src_datums = decoded_handle_.value_->get_column(i);
+        common::ObDatum *dst_datums = datums_.at(i);
+        if (expr->is_variable_res_buf()) {
+          // string datums point into the cache value, pinned by decoded_handle_
+          for (int64_t j = 0; j < row_capacity; ++j) {
+            dst_datums[j] = src_datums[row_ids_[j]];
+          }
+        } else {
+          // fixed length results are expected to stay in the expr frame
+          char *res_buf = eval_ctx_.frames_[expr->frame_idx_] + expr->res_buf_off_;
+          for (int64_t j = 0; j < row_capacity; ++j) {
+            const common::ObDatum &src = src_datums[row_ids_[j]];
+            char *dst_buf = res_buf + expr->res_buf_len_ * j;
+            if (OB_UNLIKELY(src.len_ > expr->res_buf_len_)) {
+              dst_datums[j] = src;
+            } else {
+              if (!src.is_null()) {
+                MEMCPY(dst_buf, src.ptr_, src.len_);
+              }
+              dst_datums[j].pack_ = src.pack_;
+              dst_datums[j].ptr_ = dst_buf;
+            }
+          }
+        }
+      }
+      filled = true;
+    }
+  }
+  return ret;
+}
+
+int ObVectorStore::decode_block_to_cache(
+    blocksstable::ObMicroBlockDecoder &decoder,
+    const blocksstable::ObDecodedColumnCacheKey &key)
+{
+  int ret = OB_SUCCESS;
+  const int64_t row_count = decoder.row_count();
+  const int64_t col_cnt = cols_projector_.count();
+  int64_t *row_ids = nullptr;
+  const char **cell_datas = nullptr;
+  common::ObDatum **columns = nullptr;
+  common::ObSEArray<common::ObDatum *, 16> column_datums;
+  blocksstable::ObDecodedColumnCacheValue value;
+  decoded_allocator_.reuse();
+  if (OB_ISNULL(row_ids = static_cast<int64_t *>(decoded_allocator_.alloc(sizeof(int64_t) * row_count)))
+      || OB_ISNULL(cell_datas = static_cast<const char **>(decoded_allocator_.alloc(sizeof(char *) * row_count)))
+      || OB_ISNULL(columns = static_cast<common::ObDatum **>(decoded_allocator_.alloc(sizeof(common::ObDatum *) * col_cnt)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("fail to alloc decode buffer", K(ret), K(row_count), K(col_cnt));
+  } else {
+    for (int64_t i = 0; i < row_count; ++i) {
+      row_ids[i] = i;
+    }
+  }
+  // lay out the datums like the expr frames, decoders write fixed length values in place
+  for (int64_t i = 0; OB_SUCC(ret) && i < col_cnt; ++i) {
+    const int64_t res_buf_len = exprs_.at(i)->res_buf_len_;
+    char *res_buf = nullptr;
+    if (OB_ISNULL(columns[i] = static_cast<common::ObDatum *>(decoded_allocator_.alloc(sizeof(common::ObDatum) * row_count)))
+        || OB_ISNULL(res_buf = static_cast<char *>(decoded_allocator_.alloc(res_buf_len * row_count)))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      LOG_WARN("fail to alloc decoded datums", K(ret), K(row_count), K(res_buf_len));
+    } else {
+      for (int64_t j = 0; j < row_count; ++j) {
+        new (columns[i] + j) common::ObDatum();
+        columns[i][j].ptr_ = res_buf + res_buf_len * j;
+      }
+      if (OB_FAIL(column_datums.push_back(columns[i]))) {
+        LOG_WARN("fail to push back column datums", K(ret), K(i));
+      }
+    }
+  }
+  if (OB_FAIL(ret)) {
+  } else if (OB_FAIL(decoder.get_rows(cols_projector_, col_params_, row_ids, cell_datas, row_count, column_datums))) {
+    LOG_WARN("fail to decode whole block", K(ret), K(row_count));
+  } else if (OB_FAIL(value.init(columns, col_cnt, row_count))) {
+    LOG_WARN("fail to init decoded column cache value", K(ret));
+  } else if (OB_FAIL(OB_STORE_CACHE.get_decoded_column_cache().put_and_fetch_columns(key, value, decoded_handle_))) {
+    if (OB_ENTRY_EXIST != ret) {
+      LOG_WARN("fail to put decoded columns to cache", K(ret), K(key));
+    }
+  }
+  decoded_allocator_.reuse();
+  return ret;
+}
+
 void ObVectorStore::fill_group_idx(const int64_t group_idx)
 {
   if (nullptr != group_idx_expr_) {
@@ -18,6 +18,7 @@
 #include "sql/engine/expr/ob_expr.h"
 #include "ob_block_batched_row_store.h"
 #include "storage/blocksstable/ob_datum_row.h"
+#include "storage/blocksstable/ob_decoded_column_cache.h"
 
 namespace oceanbase
 {
@@ -25,7 +26,7 @@ namespace oceanbase
 namespace blocksstable
 {
 class ObIMicroBlockReader;
-class ObIMicroBlockReader;
+class ObMicroBlockDecoder;
 }
 
 namespace storage
@@ -48,6 +49,15 @@ public:
       const int64_t end_index,
       const common::ObBitmap *bitmap = nullptr) override;
   virtual int fill_row(blocksstable::ObDatumRow &row) override;
+  virtual void set_micro_block_id(
+      const blocksstable::MacroBlockId &macro_id,
+      const bool has_data_checksum,
+      const int64_t data_checksum) override
+  {
+    micro_macro_id_ = macro_id;
+    has_micro_data_checksum_ = has_data_checksum;
+    micro_data_checksum_ = data_checksum;
+  }
   void set_end()
   {
     if (count_ > 0) {
@@ -61,6 +71,13 @@ public:
   DECLARE_TO_STRING;
 private:
   void fill_group_idx(const int64_t group_idx);
+  int fill_rows_from_decoded_cache(
+      blocksstable::ObMicroBlockDecoder &decoder,
+      const int64_t row_capacity,
+      bool &filled);
+  int decode_block_to_cache(
+      blocksstable::ObMicroBlockDecoder &decoder,
+      const blocksstable::ObDecodedColumnCacheKey &key);
 
   int64_t count_;
   // exprs needed fill in
@@ -72,6 +89,13 @@ private:
   blocksstable::ObDatumRow row_buf_;
   sql::ObExpr *group_idx_expr_;
   blocksstable::ObDatumRow default_row_;
+  // decoded column cache tier, only used for encoded blocks without char padding
+  bool enable_decoded_cache_;
+  blocksstable::MacroBlockId micro_macro_id_;
+  bool has_micro_data_checksum_;
+  int64_t micro_data_checksum_;
+  blocksstable::ObDecodedColumnValueHandle decoded_handle_;
+  common::ObArenaAllocator decoded_allocator_;
 };
 
 }
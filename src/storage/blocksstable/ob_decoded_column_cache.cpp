@@ -0,0 +1,252 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX STORAGE
+
+#include "ob_decoded_column_cache.h"
+#include "lib/hash_func/murmur_hash.h"
+#include "ob_imicro_block_reader.h"
+
+namespace oceanbase
+{
+using namespace common;
+namespace blocksstable
+{
+
+/**
+ * -----------------------------------------------------ObDecodedColumnCacheKey--------------------------------------------------
+ */
+ObDecodedColumnCacheKey::ObDecodedColumnCacheKey()
+  : tenant_id_(0),
+    macro_id_(),
+    data_checksum_(0),
+    row_count_(0),
+    col_cnt_(0),
+    cols_(nullptr)
+{
+}
+
+ObDecodedColumnCacheKey::ObDecodedColumnCacheKey(
+    const uint64_t tenant_id,
+    const MacroBlockId &macro_id,
+    const int64_t data_checksum,
+    const int64_t row_count,
+    const ObIArray<int32_t> &cols_projector)
+  : tenant_id_(tenant_id),
+    macro_id_(macro_id),
+    data_checksum_(data_checksum),
+    row_count_(row_count),
+    col_cnt_(cols_projector.count()),
+    cols_(cols_projector.count() > 0 ? &cols_projector.at(0) : nullptr)
+{
+}
+
+uint64_t ObDecodedColumnCacheKey::get_tenant_id() const
+{
+  return tenant_id_;
+}
+
+bool ObDecodedColumnCacheKey::get_micro_data_checksum(const ObMicroBlockData &block_data, int64_t &data_checksum)
+{
+  const ObMicroBlockHeader *micro_header = block_data.get_micro_header();
+  data_checksum = nullptr == micro_header ? 0 : micro_header->data_checksum_;
+  return nullptr != micro_header;
+}
+
+int ObDecodedColumnCacheKey::hash(uint64_t &hash_value) const
+{
+  hash_value = murmurhash(&tenant_id_, sizeof(tenant_id_), 0);
+  hash_value = murmurhash(&macro_id_, sizeof(macro_id_), hash_value);
+  hash_value = murmurhash(&data_checksum_, sizeof(data_checksum_), hash_value);
+  hash_value = murmurhash(&row_count_, sizeof(row_count_), hash_value);
+  if (col_cnt_ > 0) {
+    hash_value = murmurhash(cols_, static_cast<int32_t>(sizeof(int32_t) * col_cnt_), hash_value);
+  }
+  return OB_SUCCESS;
+}
+
+int ObDecodedColumnCacheKey::equal(const ObIKVCacheKey &other, bool &equal) const
+{
+  const ObDecodedColumnCacheKey &other_key = reinterpret_cast<const ObDecodedColumnCacheKey &>(other);
+  equal = tenant_id_ == other_key.tenant_id_;
+  equal &= macro_id_ == other_key.macro_id_;
+  equal &= data_checksum_ == other_key.data_checksum_;
+  equal &= row_count_ == other_key.row_count_;
+  equal &= col_cnt_ == other_key.col_cnt_;
+  if (equal && col_cnt_ > 0) {
+    equal = 0 == MEMCMP(cols_, other_key.cols_, sizeof(int32_t) * col_cnt_);
+  }
+  return OB_SUCCESS;
+}
+
+int64_t ObDecodedColumnCacheKey::size() const
+{
+  return sizeof(*this) + sizeof(int32_t) * col_cnt_;
+}
+
+int ObDecodedColumnCacheKey::deep_copy(char *buf, const int64_t buf_len, ObIKVCacheKey *&key) const
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(nullptr == buf || buf_len < size())) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid arguments", K(ret), KP(buf), K(buf_len), "request_size", size());
+  } else if (OB_UNLIKELY(!is_valid())) {
+    ret = OB_INVALID_DATA;
+    LOG_WARN("invalid decoded column cache key", K(ret), K(*this));
+  } else {
+    ObDecodedColumnCacheKey *pkey = new (buf) ObDecodedColumnCacheKey();
+    int32_t *cols = reinterpret_cast<int32_t *>(buf + sizeof(*this));
+    MEMCPY(cols, cols_, sizeof(int32_t) * col_cnt_);
+    pkey->tenant_id_ = tenant_id_;
+    pkey->macro_id_ = macro_id_;
+    pkey->data_checksum_ = data_checksum_;
+    pkey->row_count_ = row_count_;
+    pkey->col_cnt_ = col_cnt_;
+    pkey->cols_ = cols;
+    key = pkey;
+  }
+  return ret;
+}
+
+bool ObDecodedColumnCacheKey::is_valid() const
+{
+  return OB_LIKELY(0 != tenant_id_ && OB_INVALID_TENANT_ID != tenant_id_ && macro_id_.is_valid()
+      && row_count_ > 0 && col_cnt_ > 0 && nullptr != cols_);
+}
+
+/**
+ * -----------------------------------------------------ObDecodedColumnCacheValue--------------------------------------------------
+ */
+ObDecodedColumnCacheValue::ObDecodedColumnCacheValue()
+  : columns_(nullptr),
+    col_cnt_(0),
+    row_count_(0),
+    data_size_(0)
+{
+}
+
+int ObDecodedColumnCacheValue::init(ObDatum **columns, const int64_t col_cnt, const int64_t row_count)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(nullptr == columns || col_cnt <= 0 || row_count <= 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid arguments", K(ret), KP(columns), K(col_cnt), K(row_count));
+  } else {
+    columns_ = columns;
+    col_cnt_ = col_cnt;
+    row_count_ = row_count;
+    data_size_ = 0;
+    for (int64_t i = 0; i < col_cnt_; ++i) {
+      const ObDatum *col_datums = columns_[i];
+      for (int64_t j = 0; j < row_count_; ++j) {
+        if (!col_datums[j].is_null()) {
+          data_size_ += col_datums[j].len_;
+        }
+      }
+    }
+  }
+  return ret;
+}
+
+int64_t ObDecodedColumnCacheValue::size() const
+{
+  return sizeof(*this) + (sizeof(ObDatum *) + sizeof(ObDatum) * row_count_) * col_cnt_ + data_size_;
+}
+
+int ObDecodedColumnCacheValue::deep_copy(char *buf, const int64_t buf_len, ObIKVCacheValue *&value) const
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(nullptr == buf || buf_len < size())) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid arguments", K(ret), KP(buf), K(buf_len), "request_size", size());
+  } else if (OB_UNLIKELY(!is_valid())) {
+    ret = OB_INVALID_DATA;
+    LOG_WARN("invalid decoded column cache value", K(ret), K(*this));
+  } else {
+    ObDecodedColumnCacheValue *pvalue = new (buf) ObDecodedColumnCacheValue();
+    int64_t pos = sizeof(*this);
+    pvalue->columns_ = reinterpret_cast<ObDatum **>(buf + pos);
+    pos += sizeof(ObDatum *) * col_cnt_;
+    for (int64_t i = 0; i < col_cnt_; ++i) {
+      pvalue->columns_[i] = reinterpret_cast<ObDatum *>(buf + pos);
+      pos += sizeof(ObDatum) * row_count_;
+    }
+    for (int64_t i = 0; OB_SUCC(ret) && i < col_cnt_; ++i) {
+      const ObDatum *src_datums = columns_[i];
+      ObDatum *dst_datums = pvalue->columns_[i];
+      for (int64_t j = 0; OB_SUCC(ret) && j < row_count_; ++j) {
+        new (dst_datums + j) ObDatum();
+        if (OB_FAIL(dst_datums[j].deep_copy(src_datums[j], buf, buf_len, pos))) {
+          LOG_WARN("fail to deep copy datum", K(ret), K(i), K(j), K(buf_len), K(pos));
+        }
+      }
+    }
+    if (OB_SUCC(ret)) {
+      pvalue->col_cnt_ = col_cnt_;
+      pvalue->row_count_ = row_count_;
+      pvalue->data_size_ = data_size_;
+      value = pvalue;
+    } else {
+      pvalue->~ObDecodedColumnCacheValue();
+    }
+  }
+  return ret;
+}
+
+/**
+ * -----------------------------------------------------ObDecodedColumnCache--------------------------------------------------
+ */
+int ObDecodedColumnCache::get_columns(const ObDecodedColumnCacheKey &key, ObDecodedColumnValueHandle &handle)
+{
+  int ret = OB_SUCCESS;
+  const ObDecodedColumnCacheValue *value = nullptr;
+  if (OB_UNLIKELY(!key.is_valid())) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid arguments", K(ret), K(key));
+  } else if (OB_FAIL(get(key, value, handle.handle_))) {
+    if (OB_UNLIKELY(OB_ENTRY_NOT_EXIST != ret)) {
+      LOG_WARN("fail to get key from decoded column cache", K(ret), K(key));
+    }
+  } else if (OB_ISNULL(value)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("unexpected error, the value must not be NULL", K(ret));
+  } else {
+    handle.value_ = value;
+  }
+  return ret;
+}
+
+int ObDecodedColumnCache::put_and_fetch_columns(
+    const ObDecodedColumnCacheKey &key,
+    const ObDecodedColumnCacheValue &value,
+    ObDecodedColumnValueHandle &handle)
+{
+  int ret = OB_SUCCESS;
+  const ObDecodedColumnCacheValue *pvalue = nullptr;
+  if (OB_UNLIKELY(!key.is_valid() || !value.is_valid())) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid arguments", K(ret), K(key), K(value));
+  } else if (OB_FAIL(put_and_fetch(key, value, pvalue, handle.handle_, false/*overwrite*/))) {
+    if (OB_UNLIKELY(OB_ENTRY_EXIST != ret)) {
+      LOG_WARN("fail to put decoded columns to cache", K(ret), K(key), K(value));
+    }
+  } else if (OB_ISNULL(pvalue)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("unexpected error, the value must not be NULL", K(ret));
+  } else {
+    handle.value_ = pvalue;
+  }
+  return ret;
+}
+
+}  // end namespace blocksstable
+}  // end namespace oceanbase
@@ -0,0 +1,119 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_BLOCKSSTABLE_OB_DECODED_COLUMN_CACHE_H_
+#define OCEANBASE_BLOCKSSTABLE_OB_DECODED_COLUMN_CACHE_H_
+
+#include "share/cache/ob_kv_storecache.h"
+#include "lib/container/ob_array_wrap.h"
+#include "share/datum/ob_datum.h"
+#include "ob_macro_block_id.h"
+
+namespace oceanbase
+{
+namespace blocksstable
+{
+struct ObMicroBlockData;
+
+// Secondary tier above the micro block cache: keeps the projected columns of an
+// encoded micro block already decoded into datum vectors, so that vectorized scans
+// over hot blocks copy datums instead of running the column decoders again.
+// A micro block is identified by its macro block and data checksum, the projector
+// is part of the key since different queries decode different column subsets.
+class ObDecodedColumnCacheKey : public common::ObIKVCacheKey
+{
+public:
+  ObDecodedColumnCacheKey();
+  ObDecodedColumnCacheKey(
+      const uint64_t tenant_id,
+      const MacroBlockId &macro_id,
+      const int64_t data_checksum,
+      const int64_t row_count,
+      const common::ObIArray<int32_t> &cols_projector);
+  virtual ~ObDecodedColumnCacheKey() = default;
+  virtual int equal(const ObIKVCacheKey &other, bool &equal) const override;
+  virtual int hash(uint64_t &hash_value) const override;
+  virtual uint64_t get_tenant_id() const override;
+  virtual int64_t size() const override;
+  virtual int deep_copy(char *buf, const int64_t buf_len, ObIKVCacheKey *&key) const override;
+  bool is_valid() const;
+  // Only blocks read together with their micro header can be cached, the header data checksum
+  // is what tells apart micro blocks of one macro block with the same row count.
+  static bool get_micro_data_checksum(const ObMicroBlockData &block_data, int64_t &data_checksum);
+  TO_STRING_KV(K_(tenant_id), K_(macro_id), K_(data_checksum), K_(row_count), K_(col_cnt),
+               "cols", common::ObArrayWrap<int32_t>(cols_, col_cnt_));
+private:
+  uint64_t tenant_id_;
+  MacroBlockId macro_id_;
+  int64_t data_checksum_;
+  int64_t row_count_;
+  int64_t col_cnt_;
+  const int32_t *cols_;
+  DISALLOW_COPY_AND_ASSIGN(ObDecodedColumnCacheKey);
+};
+
+class ObDecodedColumnCacheValue : public common::ObIKVCacheValue
+{
+public:
+  ObDecodedColumnCacheValue();
+  virtual ~ObDecodedColumnCacheValue() = default;
+  // @columns: col_cnt arrays of row_count datums each, shallow copies into the decoded block
+  int init(common::ObDatum **columns, const int64_t col_cnt, const int64_t row_count);
+  virtual int64_t size() const override;
+  virtual int deep_copy(char *buf, const int64_t buf_len, ObIKVCacheValue *&value) const override;
+  bool is_valid() const { return nullptr != columns_ && col_cnt_ > 0 && row_count_ > 0; }
+  OB_INLINE const common::ObDatum *get_column(const int64_t idx) const { return columns_[idx]; }
+  OB_INLINE int64_t get_column_cnt() const { return col_cnt_; }
+  OB_INLINE int64_t get_row_count() const { return row_count_; }
+  TO_STRING_KV(KP_(columns), K_(col_cnt), K_(row_count), K_(data_size));
+private:
+  common::ObDatum **columns_;
+  int64_t col_cnt_;
+  int64_t row_count_;
+  int64_t data_size_;
+};
+
+struct ObDecodedColumnValueHandle
+{
+  ObDecodedColumnValueHandle()
+    : value_(nullptr), handle_()
+  {}
+  ~ObDecodedColumnValueHandle() = default;
+  bool is_valid() const { return nullptr != value_ && value_->is_valid() && handle_.is_valid(); }
+  void reset()
+  {
+    value_ = nullptr;
+    handle_.reset();
+  }
+  TO_STRING_KV(KP_(value), K_(handle));
+  const ObDecodedColumnCacheValue *value_;
+  common::ObKVCacheHandle handle_;
+};
+
+class ObDecodedColumnCache : public common::ObKVCache<ObDecodedColumnCacheKey, ObDecodedColumnCacheValue>
+{
+public:
+  ObDecodedColumnCache() = default;
+  virtual ~ObDecodedColumnCache() = default;
+  int get_columns(const ObDecodedColumnCacheKey &key, ObDecodedColumnValueHandle &handle);
+  int put_and_fetch_columns(
+      const ObDecodedColumnCacheKey &key,
+      const ObDecodedColumnCacheValue &value,
+      ObDecodedColumnValueHandle &handle);
+private:
+  DISALLOW_COPY_AND_ASSIGN(ObDecodedColumnCache);
+};
+
+}  // end namespace blocksstable
+}  // end namespace oceanbase
+
+#endif  // OCEANBASE_BLOCKSSTABLE_OB_DECODED_COLUMN_CACHE_H_
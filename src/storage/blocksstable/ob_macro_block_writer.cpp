@@ -18,6 +18,7 @@
 #include "share/config/ob_server_config.h"
 #include "share/ob_force_print_log.h"
 #include "share/ob_task_define.h"
+#include "share/rc/ob_tenant_base.h"
 #include "share/schema/ob_table_schema.h"
 #include "storage/blocksstable/ob_index_block_builder.h"
 #include "storage/blocksstable/ob_index_block_macro_iterator.h"
@@ -247,6 +248,279 @@ int ObMicroBlockBufferHelper::dump_micro_block_writer_buffer(const char *buf, co
   return ret;
 }
 
+/**
+ * ---------------------------------------------------------ObMicroBlockCompressTask--------------------------------------------------------------
+ */
+ObMicroBlockCompressTask::ObMicroBlockCompressTask()
+  : is_inited_(false),
+    is_done_(true),
+    is_claimed_(true),
+    in_queue_(false),
+    ret_code_(OB_SUCCESS),
+    tenant_ctx_(nullptr),
+    helper_(),
+    micro_block_desc_(),
+    header_(),
+    block_size_(0),
+    buf_(nullptr),
+    buf_capacity_(0),
+    cond_(),
+    allocator_("MicroCompTask", OB_MALLOC_NORMAL_BLOCK_SIZE, MTL_ID()),
+    rowkey_allocator_("MicroCompTask", OB_MALLOC_NORMAL_BLOCK_SIZE, MTL_ID())
+{
+}
+
+ObMicroBlockCompressTask::~ObMicroBlockCompressTask()
+{
+  reset();
+}
+
+int ObMicroBlockCompressTask::init(ObDataStoreDesc &data_store_desc, ObTableReadInfo &read_info)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(is_inited_)) {
+    ret = OB_INIT_TWICE;
+    STORAGE_LOG(WARN, "micro block compress task init twice", K(ret));
+  } else if (OB_ISNULL(tenant_ctx_ = MTL_CTX())) {
+    ret = OB_ERR_UNEXPECTED;
+    STORAGE_LOG(WARN, "tenant ctx is null", K(ret));
+  } else if (OB_FAIL(cond_.init(ObWaitEventIds::DEFAULT_COND_WAIT))) {
+    STORAGE_LOG(WARN, "failed to init thread cond", K(ret));
+  } else if (OB_FAIL(helper_.open(data_store_desc, read_info, allocator_))) {
+    STORAGE_LOG(WARN, "failed to open micro block buffer helper", K(ret));
+  } else {
+    is_done_ = true;
+    is_claimed_ = true;
+    in_queue_ = false;
+    ret_code_ = OB_SUCCESS;
+    is_inited_ = true;
+  }
+  return ret;
+}
+
+void ObMicroBlockCompressTask::reset()
+{
+  if (is_inited_) {
+    // never release buffers still referenced by a pool thread or its queue
+    process();
+    ObThreadCondGuard guard(cond_);
+    while (!is_done_ || in_queue_) {
+      cond_.wait(WAIT_INTERVAL_MS);
+    }
+  }
+  is_inited_ = false;
+  is_done_ = true;
+  is_claimed_ = true;
+  in_queue_ = false;
+  ret_code_ = OB_SUCCESS;
+  tenant_ctx_ = nullptr;
+  helper_.reset();
+  micro_block_desc_.reset();
+  header_.reset();
+  block_size_ = 0;
+  if (OB_NOT_NULL(buf_)) {
+    ob_free(buf_);
+    buf_ = nullptr;
+  }
+  buf_capacity_ = 0;
+  cond_.destroy();
+  allocator_.reset();
+  rowkey_allocator_.reset();
+}
+
+int ObMicroBlockCompressTask::reserve_buf(const int64_t size)
+{
+  int ret = OB_SUCCESS;
+  if (size > buf_capacity_) {
+    char *new_buf = nullptr;
+    if (OB_ISNULL(new_buf = static_cast<char *>(ob_malloc(size, ObMemAttr(MTL_ID(), "MicroCompTask"))))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      STORAGE_LOG(WARN, "failed to alloc micro block buffer", K(ret), K(size));
+    } else {
+      if (OB_NOT_NULL(buf_)) {
+        ob_free(buf_);
+      }
+      buf_ = new_buf;
+      buf_capacity_ = size;
+    }
+  }
+  return ret;
+}
+
+int ObMicroBlockCompressTask::assign(const ObMicroBlockDesc &micro_block_desc, bool &need_submit)
+{
+  int ret = OB_SUCCESS;
+  need_submit = false;
+  if (OB_UNLIKELY(!is_inited_)) {
+    ret = OB_NOT_INIT;
+    STORAGE_LOG(WARN, "micro block compress task not inited", K(ret));
+  } else if (OB_UNLIKELY(!is_done_)) {
+    ret = OB_ERR_UNEXPECTED;
+    STORAGE_LOG(WARN, "micro block compress task is still running", K(ret), KPC(this));
+  } else if (OB_UNLIKELY(!micro_block_desc.is_valid())) {
+    ret = OB_INVALID_ARGUMENT;
+    STORAGE_LOG(WARN, "invalid micro block desc", K(ret), K(micro_block_desc));
+  } else {
+    const ObMicroBlockHeader &header = *micro_block_desc.header_;
+    const int64_t checksum_size = header.has_column_checksum_ ? header.column_count_ * sizeof(int64_t) : 0;
+    rowkey_allocator_.reuse();
+    micro_block_desc_ = micro_block_desc;
+    if (OB_FAIL(reserve_buf(checksum_size + micro_block_desc.buf_size_))) {
+      STORAGE_LOG(WARN, "failed to reserve micro block buffer", K(ret), K(checksum_size), K(micro_block_desc));
+    } else if (OB_FAIL(micro_block_desc.last_rowkey_.deep_copy(micro_block_desc_.last_rowkey_, rowkey_allocator_))) {
+      STORAGE_LOG(WARN, "failed to deep copy last rowkey", K(ret), K(micro_block_desc));
+    } else {
+      header_ = header;
+      if (checksum_size > 0) {
+        MEMCPY(buf_, header.column_checksums_, checksum_size);
+        header_.column_checksums_ = reinterpret_cast<int64_t *>(buf_);
+      }
+      MEMCPY(buf_ + checksum_size, micro_block_desc.buf_, micro_block_desc.buf_size_);
+      micro_block_desc_.header_ = &header_;
+      micro_block_desc_.buf_ = buf_ + checksum_size;
+      block_size_ = micro_block_desc.buf_size_;
+      ObThreadCondGuard guard(cond_);
+      ret_code_ = OB_SUCCESS;
+      is_done_ = false;
+      ATOMIC_STORE(&is_claimed_, false);
+      if (!in_queue_) {
+        in_queue_ = true;
+        need_submit = true;
+      }
+    }
+  }
+  return ret;
+}
+
+void ObMicroBlockCompressTask::on_submit_failed()
+{
+  ObThreadCondGuard guard(cond_);
+  in_queue_ = false;
+  cond_.broadcast();
+}
+
+void ObMicroBlockCompressTask::process()
+{
+  if (ATOMIC_BCAS(&is_claimed_, false, true)) {
+    compress();
+  }
+}
+
+void ObMicroBlockCompressTask::process_in_pool()
+{
+  bool claimed = false;
+  {
+    // claim under the cond so that assign either sees the queue entry gone or the new
+    // block is picked up by this entry, the task must not be touched once in_queue_ is reset
+    ObThreadCondGuard guard(cond_);
+    in_queue_ = false;
+    claimed = ATOMIC_BCAS(&is_claimed_, false, true);
+    cond_.broadcast();
+  }
+  if (claimed) {
+    compress();
+  }
+}
+
+void ObMicroBlockCompressTask::compress()
+{
+  int ret = OB_SUCCESS;
+  {
+    share::ObTenantSwitchGuard tenant_guard(tenant_ctx_);
+    if (OB_FAIL(helper_.compress_encrypt_micro_block(micro_block_desc_))) {
+      STORAGE_LOG(WARN, "failed to compress and encrypt micro block", K(ret), K_(micro_block_desc));
+    }
+  }
+  ObThreadCondGuard guard(cond_);
+  ret_code_ = ret;
+  is_done_ = true;
+  cond_.broadcast();
+}
+
+int ObMicroBlockCompressTask::wait()
+{
+  ObThreadCondGuard guard(cond_);
+  while (!is_done_) {
+    cond_.wait(WAIT_INTERVAL_MS);
+  }
+  return ret_code_;
+}
+
+void ObMicroBlockCompressTask::dump_diagnose_info()
+{
+  // the block is left uncompressed in buf_ when compression or verification fails
+  int ret = OB_SUCCESS;
+  const int64_t size = header_.header_size_ + block_size_;
+  int64_t pos = 0;
+  char *buf = nullptr;
+  if (OB_ISNULL(buf = static_cast<char *>(allocator_.alloc(size)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    STORAGE_LOG(WARN, "failed to alloc mem", K(ret), K(size));
+  } else if (OB_FAIL(header_.serialize(buf, size, pos))) {
+    STORAGE_LOG(WARN, "failed to serialize header", K(ret), K_(header));
+  } else {
+    MEMCPY(buf + pos, micro_block_desc_.buf_, block_size_);
+    if (OB_FAIL(helper_.dump_micro_block_writer_buffer(buf, size))) {
+      STORAGE_LOG(WARN, "failed to dump micro block", K(ret), KPC(this));
+    }
+  }
+}
+
+/**
+ * ---------------------------------------------------------ObMicroBlockCompressPool--------------------------------------------------------------
+ */
+ObMicroBlockCompressPool &ObMicroBlockCompressPool::get_instance()
+{
+  static ObMicroBlockCompressPool instance;
+  return instance;
+}
+
+int ObMicroBlockCompressPool::init()
+{
+  int ret = OB_SUCCESS;
+  const int64_t thread_cnt = MIN(MAX(get_cpu_count() / 4, 1), MAX_THREAD_CNT);
+  if (OB_UNLIKELY(is_inited_)) {
+    ret = OB_INIT_TWICE;
+    STORAGE_LOG(WARN, "micro block compress pool init twice", K(ret));
+  } else if (OB_FAIL(ObSimpleThreadPool::init(thread_cnt, MAX_TASK_CNT, "MicroBlkComp"))) {
+    STORAGE_LOG(WARN, "failed to init micro block compress pool", K(ret), K(thread_cnt));
+  } else {
+    is_inited_ = true;
+    STORAGE_LOG(INFO, "succeed to init micro block compress pool", K(thread_cnt));
+  }
+  return ret;
+}
+
+void ObMicroBlockCompressPool::destroy()
+{
+  if (is_inited_) {
+    // tasks left in queue are processed by handle_drop, so no writer waits forever
+    ObSimpleThreadPool::destroy();
+    is_inited_ = false;
+  }
+}
+
+int ObMicroBlockCompressPool::submit(ObMicroBlockCompressTask &task)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(!is_inited_)) {
+    ret = OB_NOT_INIT;
+    STORAGE_LOG(WARN, "micro block compress pool not inited", K(ret));
+  } else if (OB_FAIL(push(&task))) {
+    if (OB_EAGAIN != ret) {
+      STORAGE_LOG(WARN, "failed to push micro block compress task", K(ret));
+    }
+  }
+  return ret;
+}
+
+void ObMicroBlockCompressPool::handle(void *task)
+{
+  if (OB_NOT_NULL(task)) {
+    static_cast<ObMicroBlockCompressTask *>(task)->process_in_pool();
+  }
+}
+
 /**
  * ---------------------------------------------------------ObMacroBlockWriter--------------------------------------------------------------
  */
@@ -270,7 +544,10 @@ ObMacroBlockWriter::ObMacroBlockWriter()
    datum_row_(),
    check_datum_row_(),
    callback_(nullptr),
-   builder_(NULL)
+   builder_(NULL),
+   compress_tasks_(nullptr),
+   compress_task_head_(0),
+   compress_task_cnt_(0)
 {
   //macro_blocks_, macro_handles_
 }
@@ -282,6 +559,7 @@ ObMacroBlockWriter::~ObMacroBlockWriter()
 
 void ObMacroBlockWriter::reset()
 {
+  destroy_compress_tasks();
   data_store_desc_ = nullptr;
   if (OB_NOT_NULL(micro_writer_)) {
     micro_writer_->~ObIMicroBlockWriter();
@@ -367,6 +645,8 @@ int ObMacroBlockWriter::open(
         STORAGE_LOG(WARN, "Failed to init datum row", K(ret), K_(read_info));
       } else if (OB_FAIL(reader_helper_.init(allocator_))) {
         STORAGE_LOG(WARN, "Failed to init reader helper", K(ret));
+      } else if (OB_FAIL(open_compress_tasks())) {
+        STORAGE_LOG(WARN, "Failed to open micro block compress tasks", K(ret));
       }
       if (OB_SUCC(ret) && data_store_desc_->is_major_merge()) {
         if (OB_ISNULL(curr_micro_column_checksum_ = static_cast<int64_t *>(
@@ -478,6 +758,8 @@ int ObMacroBlockWriter::append_macro_block(const ObMacroBlockDesc &macro_desc)
 
   if (OB_FAIL(ret)) {
     // skip
+  } else if (OB_FAIL(flush_compress_tasks())) {
+    LOG_WARN("Fail to flush compressed micro blocks", K(ret));
   } else if (OB_FAIL(try_switch_macro_block())) {
     LOG_WARN("Fail to flush and switch macro block", K(ret));
   } else if (OB_UNLIKELY(!macro_desc.is_valid_with_macro_meta())
@@ -535,6 +817,9 @@ int ObMacroBlockWriter::append_micro_block(const ObMicroBlock &micro_block)
         STORAGE_LOG(WARN, "build_micro_block failed", K(ret));
       }
     }
+    if (OB_SUCC(ret) && OB_FAIL(flush_compress_tasks())) {
+      STORAGE_LOG(WARN, "Fail to flush compressed micro blocks", K(ret));
+    }
     if (OB_SUCC(ret)) {
       ObMicroBlockDesc micro_block_desc;
       ObMicroBlockHeader header_for_rewrite;
@@ -583,6 +868,8 @@ int ObMacroBlockWriter::close()
     STORAGE_LOG(WARN, "exceptional situation", K(ret), K_(data_store_desc), K_(micro_writer));
   } else if (micro_writer_->get_row_count() > 0 && OB_FAIL(build_micro_block())) {
     STORAGE_LOG(WARN, "macro block writer fail to build current micro block.", K(ret));
+  } else if (OB_FAIL(flush_compress_tasks())) {
+    STORAGE_LOG(WARN, "macro block writer fail to flush compressed micro blocks.", K(ret));
   } else {
     ObMacroBlock &current_block = macro_blocks_[current_index_];
     ObMacroBloomFilterCacheWriter &current_bf_writer = bf_cache_writer_[current_index_];
@@ -758,33 +1045,151 @@ int ObMacroBlockWriter::build_micro_block()
     STORAGE_LOG(WARN, "failed to build micro block desc", K(ret));
   } else if (FALSE_IT(micro_block_desc.last_rowkey_ = last_key_)) {
   } else if (FALSE_IT(block_size = micro_block_desc.buf_size_)) {
+  } else if (OB_NOT_NULL(compress_tasks_)) {
+    if (OB_FAIL(submit_compress_task(micro_block_desc))) {
+      STORAGE_LOG(WARN, "failed to submit micro block compress task", K(ret), K(micro_block_desc));
+    }
   } else if (OB_FAIL(micro_helper_.compress_encrypt_micro_block(micro_block_desc))) {
     micro_writer_->dump_diagnose_info(); // ignore dump error
     STORAGE_LOG(WARN, "failed to compress and encrypt micro block", K(ret), K(micro_block_desc));
-  } else {
-    if (OB_FAIL(write_micro_block(micro_block_desc))) {
-      STORAGE_LOG(WARN, "fail to write micro block ", K(ret), K(micro_block_desc));
-    } else if (macro_blocks_[current_index_].get_data_size() >= data_store_desc_->macro_store_size_) {
-      if (OB_FAIL(try_switch_macro_block())) {
-        STORAGE_LOG(WARN, "macro block writer fail to try switch macro block.", K(ret));
-      }
-    }
+  } else if (OB_FAIL(write_compressed_micro_block(micro_block_desc, block_size))) {
+    STORAGE_LOG(WARN, "fail to write compressed micro block", K(ret), K(micro_block_desc));
   }
   if (OB_SUCC(ret)) {
     micro_writer_->reuse();
     if (data_store_desc_->need_prebuild_bloomfilter_ && micro_rowkey_hashs_.count() > 0) {
       micro_rowkey_hashs_.reuse();
     }
-    if (OB_NOT_NULL(data_store_desc_->merge_info_)) {
-      data_store_desc_->merge_info_->original_size_ += block_size;
-      data_store_desc_->merge_info_->compressed_size_ += micro_block_desc.buf_size_;
-      data_store_desc_->merge_info_->new_micro_count_in_new_macro_++;
-    }
   }
   STORAGE_LOG(DEBUG, "build micro block desc", K(data_store_desc_->tablet_id_), K(micro_block_desc), "lbt", lbt(), K(ret));
   return ret;
 }
 
+int ObMacroBlockWriter::write_compressed_micro_block(ObMicroBlockDesc &micro_block_desc, const int64_t block_size)
+{
+  int ret = OB_SUCCESS;
+  if (OB_FAIL(write_micro_block(micro_block_desc))) {
+    STORAGE_LOG(WARN, "fail to write micro block ", K(ret), K(micro_block_desc));
+  } else if (macro_blocks_[current_index_].get_data_size() >= data_store_desc_->macro_store_size_) {
+    if (OB_FAIL(try_switch_macro_block())) {
+      STORAGE_LOG(WARN, "macro block writer fail to try switch macro block.", K(ret));
+    }
+  }
+  if (OB_SUCC(ret) && OB_NOT_NULL(data_store_desc_->merge_info_)) {
+    data_store_desc_->merge_info_->original_size_ += block_size;
+    data_store_desc_->merge_info_->compressed_size_ += micro_block_desc.buf_size_;
+    data_store_desc_->merge_info_->new_micro_count_in_new_macro_++;
+  }
+  return ret;
+}
+
+int ObMacroBlockWriter::open_compress_tasks()
+{
+  int ret = OB_SUCCESS;
+  void *buf = nullptr;
+  // bloom filter hashes are collected per micro block on the merge thread and consumed
+  // in write_micro_block, so the pipeline is only used when no bloom filter is prebuilt
+  const bool enable_pipeline = GCONF._enable_parallel_micro_block_compress
+      && ObMicroBlockCompressPool::get_instance().is_inited()
+      && OB_NOT_NULL(builder_)
+      && !data_store_desc_->need_prebuild_bloomfilter_
+      && OB_NOT_NULL(MTL_CTX());
+  if (!enable_pipeline) {
+  } else if (OB_ISNULL(buf = allocator_.alloc(sizeof(ObMicroBlockCompressTask) * COMPRESS_PIPELINE_DEPTH))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    STORAGE_LOG(WARN, "fail to allocate micro block compress tasks", K(ret));
+  } else {
+    compress_tasks_ = new (buf) ObMicroBlockCompressTask[COMPRESS_PIPELINE_DEPTH];
+    compress_task_head_ = 0;
+    compress_task_cnt_ = 0;
+    for (int64_t i = 0; OB_SUCC(ret) && i < COMPRESS_PIPELINE_DEPTH; ++i) {
+      if (OB_FAIL(compress_tasks_[i].init(*data_store_desc_, read_info_))) {
+        STORAGE_LOG(WARN, "fail to init micro block compress task", K(ret), K(i));
+      }
+    }
+    if (OB_FAIL(ret)) {
+      destroy_compress_tasks();
+    }
+  }
+  return ret;
+}
+
+int ObMacroBlockWriter::submit_compress_task(const ObMicroBlockDesc &micro_block_desc)
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(compress_tasks_)) {
+    ret = OB_ERR_UNEXPECTED;
+    STORAGE_LOG(WARN, "compress tasks not opened", K(ret));
+  } else if (compress_task_cnt_ >= COMPRESS_PIPELINE_DEPTH && OB_FAIL(write_first_compressed_micro_block())) {
+    STORAGE_LOG(WARN, "fail to write first compressed micro block", K(ret));
+  } else {
+    ObMicroBlockCompressTask &task = compress_tasks_[(compress_task_head_ + compress_task_cnt_) % COMPRESS_PIPELINE_DEPTH];
+    bool need_submit = false;
+    if (OB_FAIL(task.assign(micro_block_desc, need_submit))) {
+      STORAGE_LOG(WARN, "fail to assign micro block compress task", K(ret), K(micro_block_desc));
+    } else {
+      if (need_submit && OB_FAIL(ObMicroBlockCompressPool::get_instance().submit(task))) {
+        // pool is full or stopping, compress on the merge thread instead
+        ret = OB_SUCCESS;
+        task.on_submit_failed();
+        task.process();
+      }
+      ++compress_task_cnt_;
+    }
+  }
+  return ret;
+}
+
+int ObMacroBlockWriter::write_first_compressed_micro_block()
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(compress_tasks_) || OB_UNLIKELY(compress_task_cnt_ <= 0)) {
+    ret = OB_ERR_UNEXPECTED;
+    STORAGE_LOG(WARN, "no micro block compress task in flight", K(ret), KP_(compress_tasks), K_(compress_task_cnt));
+  } else {
+    ObMicroBlockCompressTask &task = compress_tasks_[compress_task_head_];
+    // the pool is shared by all merges, do not wait behind other tablets' blocks when
+    // this one has not been picked up yet
+    task.process();
+    const int task_ret = task.wait();
+    compress_task_head_ = (compress_task_head_ + 1) % COMPRESS_PIPELINE_DEPTH;
+    --compress_task_cnt_;
+    if (OB_FAIL(task_ret)) {
+      micro_writer_->dump_diagnose_info(); // ignore dump error
+      task.dump_diagnose_info();
+      STORAGE_LOG(WARN, "failed to compress and encrypt micro block", K(ret), K(task));
+    } else if (OB_FAIL(write_compressed_micro_block(task.get_micro_block_desc(), task.get_original_block_size()))) {
+      STORAGE_LOG(WARN, "fail to write compressed micro block", K(ret), K(task));
+    }
+  }
+  return ret;
+}
+
+int ObMacroBlockWriter::flush_compress_tasks()
+{
+  int ret = OB_SUCCESS;
+  while (OB_SUCC(ret) && OB_NOT_NULL(compress_tasks_) && compress_task_cnt_ > 0) {
+    if (OB_FAIL(write_first_compressed_micro_block())) {
+      STORAGE_LOG(WARN, "fail to write first compressed micro block", K(ret));
+    }
+  }
+  return ret;
+}
+
+void ObMacroBlockWriter::destroy_compress_tasks()
+{
+  if (OB_NOT_NULL(compress_tasks_)) {
+    for (int64_t i = 0; i < COMPRESS_PIPELINE_DEPTH; ++i) {
+      // waits for the task if a pool thread still owns it
+      compress_tasks_[i].~ObMicroBlockCompressTask();
+    }
+    allocator_.free(compress_tasks_);
+    compress_tasks_ = nullptr;
+  }
+  compress_task_head_ = 0;
+  compress_task_cnt_ = 0;
+}
+
 int ObMacroBlockWriter::build_micro_block_desc(
     const ObMicroBlock &micro_block,
     ObMicroBlockDesc &micro_block_desc,
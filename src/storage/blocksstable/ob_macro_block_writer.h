@@ -17,6 +17,8 @@
 #include "encoding/ob_micro_block_encoder.h"
 #include "lib/compress/ob_compressor.h"
 #include "lib/container/ob_array_wrap.h"
+#include "lib/lock/ob_thread_cond.h"
+#include "lib/thread/ob_simple_thread_pool.h"
 #include "ob_block_manager.h"
 #include "ob_index_block_row_struct.h"
 #include "ob_macro_block_checker.h"
@@ -32,6 +34,10 @@
 
 namespace oceanbase
 {
+namespace share
+{
+class ObTenantBase;
+}
 namespace blocksstable
 {
 class ObDataIndexBlockBuilder;
@@ -89,6 +95,72 @@ private:
   ObArenaAllocator allocator_;
 };
 
+// Holds a private copy of one encoded micro block so that it can be compressed, verified and
+// checksummed on ObMicroBlockCompressPool while the merge thread keeps encoding the next one.
+// Whoever claims the task first compresses it: a pool thread, or the merge thread itself when
+// the task reaches the head of the pipeline before the pool has picked it up.
+class ObMicroBlockCompressTask
+{
+public:
+  ObMicroBlockCompressTask();
+  ~ObMicroBlockCompressTask();
+  int init(ObDataStoreDesc &data_store_desc, ObTableReadInfo &read_info);
+  void reset();
+  // need_submit is false when the previous submission of this task is still queued in the
+  // pool, that queue entry will pick up the new block
+  int assign(const ObMicroBlockDesc &micro_block_desc, bool &need_submit);
+  void on_submit_failed();
+  // compress on the calling thread unless the task has been claimed already
+  void process();
+  // called by ObMicroBlockCompressPool for each queue entry
+  void process_in_pool();
+  int wait();
+  void dump_diagnose_info();
+  inline ObMicroBlockDesc &get_micro_block_desc() { return micro_block_desc_; }
+  inline int64_t get_original_block_size() const { return block_size_; }
+  TO_STRING_KV(K_(is_inited), K_(is_done), K_(is_claimed), K_(in_queue), K_(ret_code),
+      K_(block_size), K_(buf_capacity), K_(micro_block_desc));
+private:
+  int reserve_buf(const int64_t size);
+  void compress();
+private:
+  static const int64_t WAIT_INTERVAL_MS = 10;
+  bool is_inited_;
+  bool is_done_;
+  bool is_claimed_;
+  bool in_queue_;
+  int ret_code_;
+  share::ObTenantBase *tenant_ctx_;
+  ObMicroBlockBufferHelper helper_;
+  ObMicroBlockDesc micro_block_desc_;
+  ObMicroBlockHeader header_;
+  int64_t block_size_;
+  char *buf_;
+  int64_t buf_capacity_;
+  common::ObThreadCond cond_;
+  common::ObArenaAllocator allocator_;
+  common::ObArenaAllocator rowkey_allocator_;
+};
+
+class ObMicroBlockCompressPool : public common::ObSimpleThreadPool
+{
+public:
+  static ObMicroBlockCompressPool &get_instance();
+  int init();
+  void destroy();
+  int submit(ObMicroBlockCompressTask &task);
+  inline bool is_inited() const { return is_inited_; }
+private:
+  ObMicroBlockCompressPool() : is_inited_(false) {}
+  virtual ~ObMicroBlockCompressPool() { destroy(); }
+  virtual void handle(void *task) override;
+private:
+  static const int64_t MAX_THREAD_CNT = 8;
+  static const int64_t MAX_TASK_CNT = 4096;
+  bool is_inited_;
+  DISALLOW_COPY_AND_ASSIGN(ObMicroBlockCompressPool);
+};
+
 class ObMacroBlockWriter
 {
 public:
@@ -128,6 +200,12 @@ private:
       ObMicroBlockHeader &header);
   int build_micro_block_desc_with_reuse(const ObMicroBlock &micro_block, ObMicroBlockDesc &micro_block_desc);
   int write_micro_block(ObMicroBlockDesc &micro_block_desc);
+  int write_compressed_micro_block(ObMicroBlockDesc &micro_block_desc, const int64_t block_size);
+  int open_compress_tasks();
+  int submit_compress_task(const ObMicroBlockDesc &micro_block_desc);
+  int write_first_compressed_micro_block();
+  int flush_compress_tasks();
+  void destroy_compress_tasks();
   int check_micro_block_need_merge(const ObMicroBlock &micro_block, bool &need_merge);
   int merge_micro_block(const ObMicroBlock &micro_block);
   int flush_macro_block(ObMacroBlock &macro_block);
@@ -150,6 +228,7 @@ private:
 private:
   static const int64_t DEFAULT_MACRO_BLOCK_COUNT = 128;
   static const int64_t DEFAULT_MACRO_BLOCK_REWRTIE_THRESHOLD = 30;
+  static const int64_t COMPRESS_PIPELINE_DEPTH = 4;
   typedef common::ObSEArray<MacroBlockId, DEFAULT_MACRO_BLOCK_COUNT> MacroBlockList;
 
 private:
@@ -178,6 +257,10 @@ private:
   blocksstable::ObDatumRow check_datum_row_;
   ObIMacroBlockFlushCallback *callback_;
   ObDataIndexBlockBuilder *builder_;
+  // micro blocks in flight on ObMicroBlockCompressPool, written in submission order
+  ObMicroBlockCompressTask *compress_tasks_;
+  int64_t compress_task_head_;
+  int64_t compress_task_cnt_;
 };
 
 }//end namespace blocksstable
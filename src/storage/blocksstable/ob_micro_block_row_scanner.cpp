@@ -18,6 +18,7 @@
 #include "storage/access/ob_block_batched_row_store.h"
 #include "storage/access/ob_index_sstable_estimator.h"
 #include "storage/blocksstable/ob_index_block_row_scanner.h"
+#include "storage/blocksstable/ob_decoded_column_cache.h"
 #include "storage/tx_table/ob_tx_table.h"
 #include "storage/tx/ob_tx_data_functor.h"
 
@@ -37,6 +38,8 @@ ObIMicroBlockRowScanner::ObIMicroBlockRowScanner(common::ObIAllocator &allocator
     last_(ObIMicroBlockReaderInfo::INVALID_ROW_INDEX),
     step_(1),
     macro_id_(),
+    has_micro_data_checksum_(false),
+    micro_data_checksum_(0),
     read_info_(nullptr),
     range_(nullptr),
     sstable_(nullptr),
@@ -176,6 +179,7 @@ int ObIMicroBlockRowScanner::open(
     is_left_border_ = is_left_border;
     is_right_border_ = is_right_border;
     macro_id_ = macro_id;
+    has_micro_data_checksum_ = ObDecodedColumnCacheKey::get_micro_data_checksum(block_data, micro_data_checksum_);
   }
   return ret;
 }
@@ -215,6 +219,7 @@ int ObIMicroBlockRowScanner::get_next_rows()
       LOG_WARN("Unexpected micro block reader to pushdown", K(ret), KP(flat_reader_), KP(decoder_));
     } else if (OB_FAIL(block_row_store_->get_result_bitmap(bitmap))) {
       LOG_WARN("Failed to get pushdown filter result bitmap", K(ret));
+    } else if (FALSE_IT(batch_store->set_micro_block_id(macro_id_, has_micro_data_checksum_, micro_data_checksum_))) {
     } else if (OB_FAIL(batch_store->fill_rows(
                 range_->get_group_idx(),
                 reader_,
@@ -99,6 +99,8 @@ protected:
   int64_t step_;
   ObDatumRow row_;
   MacroBlockId macro_id_;
+  bool has_micro_data_checksum_;
+  int64_t micro_data_checksum_;
   const ObTableReadInfo *read_info_;
   const ObDatumRange *range_;
   const blocksstable::ObSSTable *sstable_;
@@ -24,6 +24,7 @@ ObStorageCacheSuite::ObStorageCacheSuite()
     user_row_cache_(),
     bf_cache_(),
     fuse_row_cache_(),
+    decoded_column_cache_(),
     is_inited_(false)
 {
 }
@@ -63,6 +64,8 @@ int ObStorageCacheSuite::init(
     STORAGE_LOG(ERROR, "failed to set bf_cache_miss_count_threshold", K(ret));
   } else if (OB_FAIL(fuse_row_cache_.init("fuse_row_cache", fuse_row_cache_priority))) {
     STORAGE_LOG(ERROR, "fail to init fuse row cache", K(ret));
+  } else if (OB_FAIL(decoded_column_cache_.init("decoded_column_cache", user_block_cache_priority))) {
+    STORAGE_LOG(ERROR, "fail to init decoded column cache", K(ret));
   } else {
     is_inited_ = true;
   }
@@ -95,6 +98,8 @@ int ObStorageCacheSuite::reset_priority(
     STORAGE_LOG(ERROR, "set priority for bloom filter cache failed, ", K(ret));
   } else if (OB_FAIL(fuse_row_cache_.set_priority(fuse_row_cache_priority))) {
     STORAGE_LOG(ERROR, "fail to set priority for fuse row cache", K(ret));
+  } else if (OB_FAIL(decoded_column_cache_.set_priority(user_block_cache_priority))) {
+    STORAGE_LOG(ERROR, "fail to set priority for decoded column cache", K(ret));
   }
   return ret;
 }
@@ -115,6 +120,7 @@ void ObStorageCacheSuite::destroy()
   user_row_cache_.destroy();
   bf_cache_.destroy();
   fuse_row_cache_.destroy();
+  decoded_column_cache_.destroy();
   is_inited_ = false;
 }
 
@@ -167,9 +167,16 @@ int ObParallelMergeCtx::init_parallel_major_merge(compaction::ObTabletMergeCtx &
     const int64_t tablet_size = merge_ctx.schema_ctx_.merge_schema_->get_tablet_size();
     const ObSSTable *first_sstable = static_cast<const ObSSTable *>(first_table);
     const int64_t macro_block_cnt = first_sstable->get_meta().get_macro_info().get_data_block_ids().count();
+    int32_t major_merge_thread = 0;
     if (OB_FAIL(get_concurrent_cnt(tablet_size, macro_block_cnt, concurrent_cnt_))) {
       STORAGE_LOG(WARN, "failed to get concurrent cnt", K(ret), K(tablet_size), K(concurrent_cnt_),
         KPC(first_sstable));
+    } else if (concurrent_cnt_ > 1
+        && OB_FAIL(MTL(ObTenantDagScheduler *)->get_up_limit(ObDagPrio::DAG_PRIO_COMPACTION_LOW, major_merge_thread))) {
+      STORAGE_LOG(WARN, "failed to get uplimit", K(ret), K(major_merge_thread));
+    } else if (concurrent_cnt_ > 1
+        && OB_FAIL(calc_major_split_cnt(macro_block_cnt, major_merge_thread, concurrent_cnt_))) {
+      STORAGE_LOG(WARN, "failed to calc major split cnt", K(ret), K(macro_block_cnt), K_(concurrent_cnt));
     } else if (1 == concurrent_cnt_) {
       if (OB_FAIL(init_serial_merge())) {
         STORAGE_LOG(WARN, "failed to init serial merge", K(ret), KPC(first_sstable));
@@ -405,6 +412,70 @@ int ObParallelMergeCtx::get_concurrent_cnt(
   return ret;
 }
 
+/*
+ * Each parallel range is merged by its own ObTabletMergeTask, and the dag scheduler hands
+ * pending tasks to whichever compaction thread becomes idle. Splitting into several ranges
+ * per thread keeps a skewed range from holding up the whole tablet, since the other threads
+ * keep draining the remaining ranges instead of waiting. Output is still stitched in range order.
+ */
+int ObParallelMergeCtx::calc_major_split_cnt(
+    const int64_t macro_block_cnt,
+    const int64_t major_merge_thread,
+    int64_t &concurrent_cnt)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(macro_block_cnt <= 0 || concurrent_cnt <= 1)) {
+    ret = OB_INVALID_ARGUMENT;
+    STORAGE_LOG(WARN, "Invalid argument to calc major split cnt", K(ret), K(macro_block_cnt), K(concurrent_cnt));
+  } else {
+    const int64_t split_cnt = MIN(concurrent_cnt * PARALLEL_MAJOR_MERGE_SPLIT_FACTOR,
+                                  MAX(major_merge_thread, 1) * PARALLEL_MAJOR_MERGE_SPLIT_FACTOR);
+    int64_t target_cnt = MIN(MAX(concurrent_cnt, split_cnt), MIN(macro_block_cnt, MAX_MERGE_THREAD));
+    if (target_cnt > 1) {
+      // each range must hold the same number of macro blocks except the last one
+      const int64_t macro_cnt_per_range = (macro_block_cnt + target_cnt - 1) / target_cnt;
+      target_cnt = (macro_block_cnt + macro_cnt_per_range - 1) / macro_cnt_per_range;
+    }
+    if (target_cnt > concurrent_cnt) {
+      STORAGE_LOG(INFO, "split parallel major merge into more ranges", K(concurrent_cnt), K(target_cnt),
+          K(macro_block_cnt), K(major_merge_thread));
+    }
+    // always take the aligned count, get_major_range_last_macro_idxs must produce exactly
+    // concurrent_cnt ranges which does not hold for every count, e.g. 6 ranges of 10 blocks
+    concurrent_cnt = target_cnt;
+  }
+  return ret;
+}
+
+int ObParallelMergeCtx::get_major_range_last_macro_idxs(
+    const int64_t macro_block_cnt,
+    const int64_t concurrent_cnt,
+    ObIArray<int64_t> &last_macro_idxs)
+{
+  int ret = OB_SUCCESS;
+  last_macro_idxs.reset();
+  if (OB_UNLIKELY(macro_block_cnt <= 0 || concurrent_cnt <= 1 || concurrent_cnt > MAX_MERGE_THREAD)) {
+    ret = OB_INVALID_ARGUMENT;
+    STORAGE_LOG(WARN, "Invalid argument to get major range last macro idxs", K(ret), K(macro_block_cnt),
+        K(concurrent_cnt));
+  } else {
+    const int64_t macro_block_cnt_per_range = (macro_block_cnt + concurrent_cnt - 1) / concurrent_cnt;
+    for (int64_t first = 0; OB_SUCC(ret) && first < macro_block_cnt; first += macro_block_cnt_per_range) {
+      const int64_t last = MIN(first + macro_block_cnt_per_range, macro_block_cnt) - 1;
+      if (OB_FAIL(last_macro_idxs.push_back(last))) {
+        STORAGE_LOG(WARN, "Failed to push last macro idx", K(ret), K(last));
+      }
+    }
+    if (OB_FAIL(ret)) {
+    } else if (OB_UNLIKELY(concurrent_cnt != last_macro_idxs.count())) {
+      ret = OB_ERR_UNEXPECTED;
+      STORAGE_LOG(WARN, "range count is not equal to concurrent_cnt", K(ret), K(macro_block_cnt),
+          K(concurrent_cnt), K(last_macro_idxs));
+    }
+  }
+  return ret;
+}
+
 int ObParallelMergeCtx::get_major_parallel_ranges(
     const blocksstable::ObSSTable *first_major_sstable,
     const int64_t tablet_size,
@@ -420,7 +491,7 @@ int ObParallelMergeCtx::get_major_parallel_ranges(
     STORAGE_LOG(WARN, "concurrent cnt is invalid", K(ret), K_(concurrent_cnt));
   } else {
     const int64_t macro_block_cnt = first_major_sstable->get_meta().get_macro_info().get_data_block_ids().count();
-    const int64_t macro_block_cnt_per_range = (macro_block_cnt + concurrent_cnt_ - 1) / concurrent_cnt_;
+    ObSEArray<int64_t, 16> last_macro_idxs;
 
     ObDatumRowkey macro_endkey;
     ObDatumRange range;
@@ -432,14 +503,15 @@ int ObParallelMergeCtx::get_major_parallel_ranges(
     blocksstable::ObSSTableSecMetaIterator *meta_iter = nullptr;
     ObDatumRange query_range;
     query_range.set_whole_range();
-    if (OB_FAIL(first_major_sstable->scan_secondary_meta(allocator_, query_range,
+    if (OB_FAIL(get_major_range_last_macro_idxs(macro_block_cnt, concurrent_cnt_, last_macro_idxs))) {
+      STORAGE_LOG(WARN, "Failed to get major range last macro idxs", KR(ret), K(macro_block_cnt), KPC(this));
+    } else if (OB_FAIL(first_major_sstable->scan_secondary_meta(allocator_, query_range,
         index_read_info, DATA_BLOCK_META, meta_iter))) {
       STORAGE_LOG(WARN, "Failed to scan secondary meta", KR(ret), KPC(this));
     }
     // generate ranges
-    for (int64_t i = 0; OB_SUCC(ret) && i < macro_block_cnt;) {
-      int64_t last = i + macro_block_cnt_per_range - 1;
-      last = (last < macro_block_cnt ? last : macro_block_cnt - 1);
+    for (int64_t i = 0, range_idx = 0; OB_SUCC(ret) && range_idx < last_macro_idxs.count(); ++range_idx) {
+      const int64_t last = last_macro_idxs.at(range_idx);
       // locate to the last macro-block meta in current range
       while (OB_SUCC(meta_iter->get_next(blk_meta)) && i++ < last);
       if (OB_FAIL(ret)) {
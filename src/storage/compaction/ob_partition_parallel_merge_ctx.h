@@ -57,6 +57,9 @@ private:
   static const int64_t MIN_PARALLEL_MINI_MINOR_MERGE_THREASHOLD = 2;
   static const int64_t MIN_PARALLEL_MERGE_BLOCKS = 32;
   static const int64_t PARALLEL_MERGE_TARGET_TASK_CNT = 20;
+  // split major merge into more ranges than dag threads, so that the merge tasks
+  // act as a shared work queue and idle threads pick up the remaining ranges
+  static const int64_t PARALLEL_MAJOR_MERGE_SPLIT_FACTOR = 4;
   //TODO @hanhui parallel in ai
   int init_serial_merge();
   int init_parallel_mini_merge(compaction::ObTabletMergeCtx &merge_ctx);
@@ -71,6 +74,15 @@ private:
       const int64_t tablet_size,
       const int64_t macro_block_cnt,
       int64_t &concurrent_cnt);
+  static int calc_major_split_cnt(
+      const int64_t macro_block_cnt,
+      const int64_t major_merge_thread,
+      int64_t &concurrent_cnt);
+  // index of the last macro block of each range, ranges are (prev last, last]
+  static int get_major_range_last_macro_idxs(
+      const int64_t macro_block_cnt,
+      const int64_t concurrent_cnt,
+      common::ObIArray<int64_t> &last_macro_idxs);
   int get_major_parallel_ranges(
       const blocksstable::ObSSTable *first_major_sstable,
       const int64_t tablet_size,
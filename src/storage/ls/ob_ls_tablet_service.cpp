@@ -3194,19 +3194,22 @@ int ObLSTabletService::insert_tablet_rows(
     LOG_WARN("rowkeys already exist", K(ret), K(table), K(rows_info));
   }
 
-  for (int64_t k = 0; OB_SUCC(ret) && k < row_count; k++) {
-    ObStoreRow &tbl_row = rows[k];
-    if (GCONF.enable_defensive_check()
-          && OB_FAIL(check_new_row_legitimacy(run_ctx, tbl_row.row_val_))) {
-        LOG_WARN("check new row legitimacy failed", K(ret), K(tbl_row.row_val_));
-    } else if (OB_FAIL(tablet_handle.get_obj()->insert_row_without_rowkey_check(table, run_ctx.store_ctx_,
-        *run_ctx.col_descs_, tbl_row))) {
-      if (OB_TRY_LOCK_ROW_CONFLICT != ret) {
-        LOG_WARN("fail to insert row to data tablet", K(ret), K(tbl_row));
+  if (OB_SUCC(ret) && GCONF.enable_defensive_check()) {
+    for (int64_t k = 0; OB_SUCC(ret) && k < row_count; k++) {
+      if (OB_FAIL(check_new_row_legitimacy(run_ctx, rows[k].row_val_))) {
+        LOG_WARN("check new row legitimacy failed", K(ret), K(rows[k].row_val_));
       }
     }
   }
 
+  if (OB_FAIL(ret)) {
+  } else if (OB_FAIL(tablet_handle.get_obj()->insert_rows_without_rowkey_check(table, run_ctx.store_ctx_,
+      *run_ctx.col_descs_, rows, row_count))) {
+    if (OB_TRY_LOCK_ROW_CONFLICT != ret) {
+      LOG_WARN("fail to insert rows to data tablet", K(ret), K(row_count));
+    }
+  }
+
   if (OB_ERR_PRIMARY_KEY_DUPLICATE == ret && !run_ctx.dml_param_.is_ignore_) {
     int tmp_ret = OB_SUCCESS;
     char rowkey_buffer[OB_TMP_BUF_SIZE_256];
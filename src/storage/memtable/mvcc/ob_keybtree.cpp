@@ -1682,7 +1682,8 @@ int ObKeyBtree::insert(const BtreeKey key, BtreeVal &value)
     }
     if (OB_EAGAIN == ret) {
       handle.free_list();
-      //sched_yield();
+      // appenders keep colliding on the right-most leaf, back off before walking down again
+      PAUSE();
     }
   }
   handle.release_ref();
@@ -1787,8 +1788,18 @@ int32_t ObKeyBtree::update_split_info(int32_t split_pos)
   if (split_pos < 0) {
     split_pos = 0;
   }
-  UNUSED(ATOMIC_FAA(&split_info_, 0x100000000ULL + split_pos));
-  const int32_t ret = split_pos_sum_ / split_count_;
+  // derive the average from the value we just published, reading split_pos_sum_ and
+  // split_count_ separately may mix in the updates of concurrent splits.
+  const uint64_t split_info = ATOMIC_AAF(&split_info_, 0x100000000ULL + split_pos);
+  const int32_t ret = static_cast<int32_t>((split_info & 0xFFFFFFFFULL) / (split_info >> 32));
+  return (ret < 1) ? 1 : ret;
+}
+
+int32_t ObKeyBtree::get_split_pos() const
+{
+  const uint64_t split_info = ATOMIC_LOAD(&split_info_);
+  const uint64_t split_count = split_info >> 32;
+  const int32_t ret = (0 == split_count) ? 0 : static_cast<int32_t>((split_info & 0xFFFFFFFFULL) / split_count);
   return (ret < 1) ? 1 : ret;
 }
 
@@ -201,6 +201,8 @@ public:
   void free_node(BtreeNode *p);
   void retire(common::HazardList &retire_list);
   int32_t update_split_info(int32_t split_pos);
+  // average split position of the splits done so far, does not record a split
+  int32_t get_split_pos() const;
   common::RetireStation &get_retire_station();
   common::QClock& get_qclock();
   common::ObQSync& get_qsync();
@@ -82,13 +82,10 @@ int ObMvccEngine::try_compact_row_when_mvcc_read_(const int64_t &snapshot_versio
                                                   ObMvccRow &row)
 {
   int ret = OB_SUCCESS;
-  const int64_t latest_compact_ts = row.latest_compact_ts_;
-  const int64_t WEAK_READ_COMPACT_THRESHOLD = 3 * 1000 * 1000;
   if (0 >= snapshot_version) {
     ret = OB_ERR_UNEXPECTED;
     TRANS_LOG(WARN, "invalid snapshot version", K(ret), K(snapshot_version));
-  } else if (INT64_MAX == snapshot_version
-      || ObTimeUtility::current_time() < latest_compact_ts + WEAK_READ_COMPACT_THRESHOLD) {
+  } else if (INT64_MAX == snapshot_version) {
     // do not compact row when merging
   } else {
     ObRowLatchGuard guard(row.latch_);
@@ -85,6 +85,7 @@ int ObMvccValueIterator::lock_for_read_(const ObQueryFlag &flag)
   lock_begin(lock_start_time);
 
   while (OB_SUCC(ret) && NULL != iter && NULL == version_iter_) {
+    ++walked_node_cnt_;
     if (OB_FAIL(lock_for_read_inner_(flag, iter))) {
       TRANS_LOG(WARN, "lock for read failed", K(ret));
     }
@@ -299,6 +300,18 @@ void ObMvccValueIterator::move_to_next_node_()
   } else {
     version_iter_ = version_iter_->prev_;
   }
+  if (OB_NOT_NULL(version_iter_)) {
+    ++walked_node_cnt_;
+  }
+}
+
+void ObMvccValueIterator::report_walked_nodes_()
+{
+  if (walked_node_cnt_ > 0) {
+    EVENT_INC(MEMSTORE_READ_WALK_COUNT);
+    EVENT_ADD(MEMSTORE_READ_WALK_NODE_COUNT, walked_node_cnt_);
+    walked_node_cnt_ = 0;
+  }
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -105,10 +105,11 @@ public:
         value_(NULL),
         version_iter_(NULL),
         last_trans_version_(INT64_MAX),
-        skip_compact_(false)
+        skip_compact_(false),
+        walked_node_cnt_(0)
   {
   }
-  virtual ~ObMvccValueIterator() {}
+  virtual ~ObMvccValueIterator() { report_walked_nodes_(); }
 public:
   int init(ObMvccAccessCtx &ctx,
            const ObMemtableKey *key,
@@ -122,6 +123,7 @@ public:
   virtual int get_next_node(const void *&tnode);
   void reset()
   {
+    report_walked_nodes_();
     is_inited_ = false;
     ctx_ = NULL;
     value_ = NULL;
@@ -135,6 +137,7 @@ private:
   int lock_for_read_inner_(const ObQueryFlag &flag, ObMvccTransNode *&iter);
   int try_cleanout_tx_node_(ObMvccTransNode *tnode);
   void move_to_next_node_();
+  void report_walked_nodes_();
   void lock_begin(int64_t &lock_start_time) const;
   void lock_for_read_end(const int64_t lock_start_time, int64_t ret) const;
 private:
@@ -148,6 +151,9 @@ private:
   ObMvccTransNode *version_iter_;
   int64_t last_trans_version_;
   bool skip_compact_;
+  // tx nodes visited on the row by this read, including the ones skipped to
+  // find the read position, reported as the memstore read walk stats
+  int64_t walked_node_cnt_;
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
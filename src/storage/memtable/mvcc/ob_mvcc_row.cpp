@@ -539,10 +539,16 @@ bool ObMvccRow::need_compact(const bool for_read, const bool for_replay)
     if (updates >= max(2048, ObServerConfig::get_instance().row_compaction_update_limit * 10)) {
       bool_ret = ATOMIC_BCAS(&update_since_compact_, updates, 0);
     }
-  } else if (updates >= compact_trigger) {
-    bool_ret = ATOMIC_BCAS(&update_since_compact_, updates, 0);
-  } else {
+  } else if (updates < compact_trigger) {
     // do nothing
+  } else if (for_read
+             && ObTimeUtility::current_time() < ATOMIC_LOAD(&latest_compact_ts_)
+                + READ_COMPACT_INTERVAL * compact_trigger / updates) {
+    // Reads shorten the compaction interval as the chain grows past the trigger,
+    // so a hot row that is read often is compacted in small steps instead of
+    // piling up until the freeze. The updates are kept for the following reads.
+  } else {
+    bool_ret = ATOMIC_BCAS(&update_since_compact_, updates, 0);
   }
 
   return bool_ret;
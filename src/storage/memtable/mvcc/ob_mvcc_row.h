@@ -182,6 +182,9 @@ struct ObMvccRow
   //when the number of nodes visited before finding the right insert position exceeds INDEX_TRIGGER_LENGTH,
   //index will be constructed and used
   static const int64_t INDEX_TRIGGER_COUNT = 500;
+  // reads compact the row at most once per interval when the update chain just
+  // reaches the read trigger, see need_compact
+  static const int64_t READ_COMPACT_INTERVAL = 3 * 1000 * 1000;
 
   // Spin lock that protects row data.
   ObRowLatch latch_;
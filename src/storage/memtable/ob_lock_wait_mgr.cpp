@@ -562,12 +562,12 @@ int ObLockWaitMgr::post_lock(const int tmp_ret,
   Node *node = NULL;
   if (OB_NOT_NULL(node = get_thread_node())) {
     Key key(&row_key);
+    const uint64_t row_hash = hash_rowkey(tablet_id, key);
     uint64_t &hold_key = get_thread_hold_key();
-    if (hold_key == hash_rowkey(tablet_id, key)) {
+    if (hold_key == row_hash) {
       hold_key = 0;
     }
     if (OB_TRY_LOCK_ROW_CONFLICT == tmp_ret) {
-      auto row_hash = hash_rowkey(tablet_id, key);
       auto tx_hash = hash_trans(holder_tx_id);
       auto row_lock_seq = get_seq(row_hash);
       auto tx_lock_seq = get_seq(tx_hash);
@@ -707,6 +707,18 @@ int ObLockWaitMgr::transform_row_lock_to_tx_lock(const ObTabletID &tablet_id,
   return ret;
 }
 
+void ObLockWaitMgr::on_row_locked(const ObTabletID &tablet_id, const Key &key)
+{
+  uint64_t &hold_key = get_thread_hold_key();
+  // On a hot row every waiter woken up by post_process would conflict with
+  // this request again, and rerun its statement for nothing.
+  if (0 != hold_key
+      && NULL != get_thread_node()
+      && hold_key == hash_rowkey(tablet_id, key)) {
+    hold_key = 0;
+  }
+}
+
 void ObLockWaitMgr::wakeup(const ObTabletID &tablet_id, const Key& key)
 {
   TRANS_LOG(TRACE, "LockWaitMgr.wakeup.byRowKey", K(tablet_id), K(key), K(lbt()));
@@ -255,6 +255,10 @@ public:
                                     const Key &key,
                                     const transaction::ObTransID &tx_id,
                                     const ObAddr &tx_scheduler);
+  // called when the request locks a row successfully. If the request was woken
+  // up for this row, the waiters behind it are woken up by its unlock, so it
+  // need not pass the wakeup on when the request ends
+  void on_row_locked(const ObTabletID &tablet_id, const Key &key);
   // wakeup the request waiting on the row
   void wakeup(const ObTabletID &tablet_id, const Key& key);
   // wakeup the request waiting on the transaction
@@ -351,6 +351,59 @@ int ObMemtable::set(
   return ret;
 }
 
+int ObMemtable::multi_set(
+    storage::ObStoreCtx &ctx,
+    const uint64_t table_id,
+    const storage::ObTableReadInfo &read_info,
+    const common::ObIArray<share::schema::ObColDesc> &columns,
+    const storage::ObStoreRow *rows,
+    const int64_t row_count)
+{
+  int ret = OB_SUCCESS;
+  ObMvccWriteGuard guard;
+  if (IS_NOT_INIT) {
+    TRANS_LOG(WARN, "not init", K(*this));
+    ret = OB_NOT_INIT;
+  } else if (NULL == ctx.mvcc_acc_ctx_.get_mem_ctx()
+             || read_info.get_schema_rowkey_count() > columns.count()
+             || NULL == rows
+             || row_count <= 0) {
+    TRANS_LOG(WARN, "invalid param", K(ctx), K(read_info),
+              K(columns.count()), KP(rows), K(row_count));
+    ret = OB_INVALID_ARGUMENT;
+  } else if (OB_FAIL(guard.write_auth(ctx))) {
+    TRANS_LOG(WARN, "not allow to write", K(ctx));
+  } else {
+    lib::CompatModeGuard compat_guard(mode_);
+
+    ret = multi_set_(ctx, table_id, read_info, columns, rows, row_count);
+    guard.set_is_freeze(freezer_->is_freeze());
+  }
+  return ret;
+}
+
+int ObMemtable::multi_set_(ObStoreCtx &ctx,
+                           const uint64_t table_id,
+                           const storage::ObTableReadInfo &read_info,
+                           const ObIArray<ObColDesc> &columns,
+                           const ObStoreRow *rows,
+                           const int64_t row_count)
+{
+  int ret = OB_SUCCESS;
+  for (int64_t i = 0; OB_SUCC(ret) && i < row_count; ++i) {
+    const ObStoreRow &row = rows[i];
+    if (OB_UNLIKELY(!row.is_valid() || row.row_val_.count_ < columns.count())) {
+      ret = OB_INVALID_ARGUMENT;
+      TRANS_LOG(WARN, "invalid row", K(ret), K(i), K(columns.count()), K(row));
+    } else if (OB_FAIL(set_(ctx, table_id, read_info, columns, row, NULL, NULL))) {
+      if (OB_TRY_LOCK_ROW_CONFLICT != ret && OB_TRANSACTION_SET_VIOLATION != ret) {
+        TRANS_LOG(WARN, "set row in batch fail", K(ret), K(i), K(row_count));
+      }
+    }
+  }
+  return ret;
+}
+
 int ObMemtable::lock_(ObStoreCtx &ctx,
                       const uint64_t table_id,
                       const storage::ObTableReadInfo &read_info,
@@ -2461,6 +2514,7 @@ int ObMemtable::mvcc_write_(storage::ObStoreCtx &ctx,
         TRANS_LOG(WARN, "lock wait mgr is null", K(ret));
       } else {
         p_lock_wait_mgr->set_hash_holder(key_.get_tablet_id(), *key, mem_ctx->get_tx_id());
+        p_lock_wait_mgr->on_row_locked(key_.get_tablet_id(), *key);
       }
     }
     /***********************/
@@ -199,6 +199,16 @@ public:
       const ObIArray<int64_t> &update_idx,
       const storage::ObStoreRow &old_row,
       const storage::ObStoreRow &new_row);
+  // write a batch of rows of one statement, the write authorization and the freeze
+  // check are done once for the whole batch while each row is still checked for
+  // conflicts individually, stops at the first row failed
+  int multi_set(
+      storage::ObStoreCtx &ctx,
+      const uint64_t table_id,
+      const storage::ObTableReadInfo &read_info,
+      const common::ObIArray<share::schema::ObColDesc> &columns,
+      const storage::ObStoreRow *rows,
+      const int64_t row_count);
 
   // lock is used to lock the row(s)
   // ctx is the locker tx's context, we need the tx_id, version and scn to do the concurrent control(mvcc_write)
@@ -490,6 +500,12 @@ private:
            const storage::ObStoreRow &new_row,
            const storage::ObStoreRow *old_row,
            const common::ObIArray<int64_t> *update_idx);
+  int multi_set_(storage::ObStoreCtx &ctx,
+                 const uint64_t table_id,
+                 const storage::ObTableReadInfo &read_info,
+                 const common::ObIArray<share::schema::ObColDesc> &columns,
+                 const storage::ObStoreRow *rows,
+                 const int64_t row_count);
   int lock_(storage::ObStoreCtx &ctx,
             const uint64_t table_id,
             const storage::ObTableReadInfo &read_info,
@@ -1247,6 +1247,68 @@ int ObTablet::insert_row_without_rowkey_check(
   return ret;
 }
 
+int ObTablet::insert_rows_without_rowkey_check(
+    ObRelativeTable &relative_table,
+    ObStoreCtx &store_ctx,
+    const common::ObIArray<share::schema::ObColDesc> &col_descs,
+    const storage::ObStoreRow *rows,
+    const int64_t row_count)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(!is_inited_)) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not inited", K(ret), K_(is_inited));
+  } else if (OB_UNLIKELY(!store_ctx.is_valid()
+      || col_descs.count() <= 0
+      || !full_read_info_.is_valid_full_read_info()
+      || nullptr == rows
+      || row_count <= 0
+      || !relative_table.is_valid())) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid args", K(ret), K(store_ctx), K(relative_table),
+        K(col_descs), KP(rows), K(row_count), K_(full_read_info));
+  } else if (OB_UNLIKELY(relative_table.get_tablet_id() != tablet_meta_.tablet_id_)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("tablet id doesn't match", K(ret), K(relative_table.get_tablet_id()), K(tablet_meta_.tablet_id_));
+  } else if (OB_FAIL(try_update_storage_schema(relative_table.get_table_id(),
+      relative_table.get_schema_version(),
+      store_ctx.mvcc_acc_ctx_.get_mem_ctx()->get_query_allocator(),
+      store_ctx.timeout_))) {
+    LOG_WARN("fail to record table schema", K(ret));
+  }
+
+  // the table guard holds the write ref of the memtable and throttles the writer when
+  // released, take it per batch so that a large statement neither blocks the freeze
+  // of the memtable nor escapes the memstore throttle
+  for (int64_t start = 0; OB_SUCC(ret) && start < row_count; start += INSERT_ROWS_BATCH_SIZE) {
+    const int64_t batch_count = MIN(INSERT_ROWS_BATCH_SIZE, row_count - start);
+    {
+      ObStorageTableGuard guard(this, store_ctx, true);
+      ObMemtable *write_memtable = nullptr;
+      if (OB_FAIL(guard.refresh_and_protect_table(relative_table))) {
+        LOG_WARN("fail to protect table", K(ret));
+      } else if (OB_FAIL(prepare_memtable(relative_table, store_ctx, write_memtable))) {
+        LOG_WARN("prepare write memtable fail", K(ret), K(relative_table));
+      } else if (OB_FAIL(write_memtable->multi_set(store_ctx, relative_table.get_table_id(),
+          full_read_info_, col_descs, rows + start, batch_count))) {
+        if (OB_TRY_LOCK_ROW_CONFLICT != ret) {
+          LOG_WARN("failed to multi set memtable", K(ret), K(start), K(batch_count));
+        }
+      }
+    }
+
+    if (OB_SUCC(ret)) {
+      int tmp_ret = OB_SUCCESS;
+      if (OB_TMP_FAIL(store_ctx.mvcc_acc_ctx_.tx_ctx_->submit_redo_log(false))) {
+        TRANS_LOG(INFO, "submit log if necessary failed", K(tmp_ret), K(store_ctx),
+                  K(relative_table));
+      }
+    }
+  }
+
+  return ret;
+}
+
 int ObTablet::do_rowkey_exists(
     ObStoreCtx &store_ctx,
     const int64_t table_id,
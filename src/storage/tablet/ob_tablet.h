@@ -180,6 +180,12 @@ public:
       ObStoreCtx &store_ctx,
       const ObColDescIArray &col_descs,
       const storage::ObStoreRow &row);
+  int insert_rows_without_rowkey_check(
+      ObRelativeTable &relative_table,
+      ObStoreCtx &store_ctx,
+      const ObColDescIArray &col_descs,
+      const storage::ObStoreRow *rows,
+      const int64_t row_count);
   int update_row(
       ObRelativeTable &relative_table,
       ObStoreCtx &store_ctx,
@@ -456,6 +462,8 @@ private:
   int check_max_sync_schema_version() const;
 private:
   static const int32_t TABLET_VERSION = 1;
+  // rows written by insert_rows_without_rowkey_check() under one storage table guard
+  static const int64_t INSERT_ROWS_BATCH_SIZE = 256;
 private:
   int32_t version_;
   int32_t length_;
@@ -285,19 +285,28 @@ void ObPartTransCtx::default_init_()
 int ObPartTransCtx::init_log_cbs_(const ObLSID &ls_id, const ObTransID &tx_id)
 {
   int ret = OB_SUCCESS;
-  for (int64_t i = 0; OB_SUCC(ret) && i < OB_TX_MAX_LOG_CBS; ++i) {
-    if (OB_FAIL(log_cbs_[i].init(ls_id, tx_id, this))) {
-      TRANS_LOG(WARN, "log cb init failed", KR(ret));
-    } else if (!free_cbs_.add_last(&log_cbs_[i])) {
-      ret = OB_INIT_FAIL;
-      TRANS_LOG(WARN, "add to free list failed", KR(ret));
-    }
+  // log_cbs_ are handed to free_cbs_ by extend_log_cbs_ when they are needed
+  if (OB_FAIL(final_log_cb_.init(ls_id, tx_id, this))) {
+    TRANS_LOG(WARN, "init commit log cb failed", K(ret));
+  } else {
+    TRANS_LOG(DEBUG, "init commit log cb success", K(ret), KP(&final_log_cb_), K(*this));
   }
-  if (OB_SUCC(ret)) {
-    if (OB_FAIL(final_log_cb_.init(ls_id, tx_id, this))) {
-      TRANS_LOG(WARN, "init commit log cb failed", K(ret));
-    } else {
-      TRANS_LOG(DEBUG, "init commit log cb success", K(ret), KP(&final_log_cb_), K(*this));
+  return ret;
+}
+
+int ObPartTransCtx::extend_log_cbs_()
+{
+  int ret = OB_SUCCESS;
+  ObTxLogCb *log_cb = NULL;
+  if (inited_log_cb_cnt_ >= OB_TX_MAX_LOG_CBS) {
+    ret = OB_TX_NOLOGCB;
+  } else if (OB_FAIL((log_cb = &log_cbs_[inited_log_cb_cnt_])->init(ls_id_, trans_id_, this))) {
+    TRANS_LOG(WARN, "log cb init failed", KR(ret), K(inited_log_cb_cnt_));
+  } else {
+    inited_log_cb_cnt_++;
+    if (!free_cbs_.add_last(log_cb)) {
+      ret = OB_ERR_UNEXPECTED;
+      TRANS_LOG(WARN, "add to free list failed", KR(ret), K(inited_log_cb_cnt_));
     }
   }
   return ret;
@@ -305,7 +314,7 @@ int ObPartTransCtx::init_log_cbs_(const ObLSID &ls_id, const ObTransID &tx_id)
 
 void ObPartTransCtx::reset_log_cbs_()
 {
-  for (int64_t i = 0; i < OB_TX_MAX_LOG_CBS; ++i) {
+  for (int64_t i = 0; i < inited_log_cb_cnt_; ++i) {
     if (OB_NOT_NULL(log_cbs_[i].get_tx_data())) {
       ObTxData *tx_data = log_cbs_[i].get_tx_data();
       ctx_tx_data_.free_tmp_tx_data(tx_data);
@@ -321,6 +330,7 @@ void ObPartTransCtx::reset_log_cbs_()
   final_log_cb_.reset();
   free_cbs_.reset();
   busy_cbs_.reset();
+  inited_log_cb_cnt_ = 0;
 }
 
 // thread-unsafe
@@ -3192,8 +3202,10 @@ int ObPartTransCtx::get_log_cb_(const bool need_final_cb, ObTxLogCb *&log_cb)
       log_cb = &final_log_cb_;
     }
   } else {
-    if (free_cbs_.is_empty()) {
-      ret = OB_TX_NOLOGCB;
+    if (free_cbs_.is_empty() && OB_FAIL(extend_log_cbs_())) {
+      if (OB_TX_NOLOGCB != ret) {
+        TRANS_LOG(WARN, "extend log cbs failed", KR(ret), K(*this));
+      }
       //TRANS_LOG(INFO, "all log cbs are busy now, try again later", K(*this));
     } else if (OB_ISNULL(log_cb = free_cbs_.remove_first())) {
       ret = OB_ERR_UNEXPECTED;
@@ -98,6 +98,7 @@ public:
       : ObTransCtx("participant", ObTransCtxType::PARTICIPANT), ObTsCbTask(),
         ObTxCycleTwoPhaseCommitter(), is_inited_(false), mt_ctx_(), exec_info_(reserve_allocator_),
         mds_cache_(reserve_allocator_),
+        inited_log_cb_cnt_(0),
         role_state_(TxCtxRoleState::FOLLOWER),
         coord_prepare_info_arr_(OB_MALLOC_NORMAL_BLOCK_SIZE,
                                 ModulePageAllocator(reserve_allocator_, "PREPARE_INFO"))
@@ -486,6 +487,7 @@ protected:
 private:
 
   int init_log_cbs_(const share::ObLSID&ls_id, const ObTransID &tx_id);
+  int extend_log_cbs_();
   void reset_log_cbs_();
   int prepare_log_cb_(const bool need_final_cb, ObTxLogCb *&log_cb);
   int get_log_cb_(const bool need_final_cb, ObTxLogCb *&log_cb);
@@ -712,6 +714,9 @@ private:
   common::ObDList<ObTxLogCb> free_cbs_;
   common::ObDList<ObTxLogCb> busy_cbs_;
   ObTxLogCb final_log_cb_;
+  // log_cbs_ are initialized on demand, the ones beyond this count are still
+  // in reset state, so short transactions do not pay for all of them.
+  int64_t inited_log_cb_cnt_;
   // The semantic of the rec_log_ts means the log ts of the first state change
   // after the previous checkpoint. So we use the current strategy to maintain
   // the rec_log_ts:
@@ -13,6 +13,7 @@
 #define USING_LOG_PREFIX STORAGE
 
 #include "lib/utility/ob_print_utils.h"
+#include "lib/alloc/ob_malloc_allocator.h"                 // ObMallocAllocator
 #include "observer/omt/ob_multi_tenant.h"                  // ObMultiTenant
 #include "share/ob_tenant_mgr.h"                           // get_virtual_memory_used
 #include "share/allocator/ob_memstore_allocator_mgr.h"     // ObMemstoreAllocatorMgr
@@ -31,6 +32,9 @@ void ObPrintTenantMemoryUsage::runTimerTask()
   ObTenantMemoryPrinter &printer = ObTenantMemoryPrinter::get_instance();
   printer.print_tenant_usage();
   ObObjFreeListList::get_freelists().dump();
+  // objects kept by the thread caches pin their blocks and chunks, idle threads never
+  // reuse them, give them back every round
+  lib::ObMallocAllocator::get_instance()->flush_object_thread_cache();
 }
 
 ObTenantMemoryPrinter &ObTenantMemoryPrinter::get_instance()
@@ -44,13 +44,12 @@ int ObTxDataMemtable::init(const ObITable::TableKey &table_key,
     min_tx_log_ts_ = INT64_MAX;
     max_tx_log_ts_ = 0;
     min_start_log_ts_ = INT64_MAX;
-    inserted_cnt_ = 0;
     deleted_cnt_ = 0;
     write_ref_ = 0;
-    occupied_size_ = 0;
     last_insert_ts_ = 0;
     state_ = ObTxDataMemtable::State::ACTIVE;
     sort_list_head_.reset();
+    reset_thread_local_list_();
     slice_allocator_ = slice_allocator;
     memtable_mgr_ = memtable_mgr;
 
@@ -84,10 +83,8 @@ void ObTxDataMemtable::reset()
   min_tx_log_ts_ = INT64_MAX;
   max_tx_log_ts_ = 0;
   min_start_log_ts_ = INT64_MAX;
-  inserted_cnt_ = 0;
   deleted_cnt_ = 0;
   write_ref_ = 0;
-  occupied_size_ = 0;
   last_insert_ts_ = 0;
   state_ = ObTxDataMemtable::State::INVALID;
   sort_list_head_.reset();
@@ -107,10 +104,28 @@ void ObTxDataMemtable::reset()
 void ObTxDataMemtable::reset_thread_local_list_()
 {
   for (int i = 0; i < MAX_TX_DATA_TABLE_CONCURRENCY; i++) {
-    local_sort_list_head_[i].reset();
+    local_insert_info_[i].reset();
   }
 }
 
+int64_t ObTxDataMemtable::get_inserted_count() const
+{
+  int64_t inserted_cnt = 0;
+  for (int i = 0; i < MAX_TX_DATA_TABLE_CONCURRENCY; i++) {
+    inserted_cnt += ATOMIC_LOAD(&local_insert_info_[i].inserted_cnt_);
+  }
+  return inserted_cnt;
+}
+
+int64_t ObTxDataMemtable::get_occupied_size() const
+{
+  int64_t occupied_size = 0;
+  for (int i = 0; i < MAX_TX_DATA_TABLE_CONCURRENCY; i++) {
+    occupied_size += ATOMIC_LOAD(&local_insert_info_[i].occupied_size_);
+  }
+  return occupied_size;
+}
+
 int ObTxDataMemtable::insert(ObTxData *tx_data)
 {
   common::ObTimeGuard tg("tx_data_memtable::insert", 100 * 1000);
@@ -143,16 +158,17 @@ int ObTxDataMemtable::insert(ObTxData *tx_data)
     common::inc_update(&max_tx_log_ts_, tx_data->end_log_ts_);
     common::dec_update(&min_tx_log_ts_, tx_data->end_log_ts_);
     common::dec_update(&min_start_log_ts_, tx_data->start_log_ts_);
-    ATOMIC_INC(&inserted_cnt_);
     tg.click();
 
     int thread_idx = ::get_itid() % MAX_TX_DATA_TABLE_CONCURRENCY;
+    LocalInsertInfo &local_info = local_insert_info_[thread_idx];
     ObTxDataSortListNode *cur_node = ObTxData::get_sort_list_node_by_tx_data(tx_data);
+    ATOMIC_INC(&local_info.inserted_cnt_);
     tg.click();
     while (true) {
-      ObTxDataSortListNode *last_node = ATOMIC_LOAD(&local_sort_list_head_[thread_idx].next_);
+      ObTxDataSortListNode *last_node = ATOMIC_LOAD(&local_info.sort_list_head_.next_);
       cur_node->next_ = last_node;
-      if (last_node == ATOMIC_CAS(&local_sort_list_head_[thread_idx].next_, last_node, cur_node)) {
+      if (last_node == ATOMIC_CAS(&local_info.sort_list_head_.next_, last_node, cur_node)) {
         break;
       }
     }
@@ -161,7 +177,7 @@ int ObTxDataMemtable::insert(ObTxData *tx_data)
     // Note : a tx data may be deleted from memtable in ObTxDataTable::insert_into_memtable_ but the
     // occupied_size would not be reduced because the memory will not be freed until freeze done.
     int64_t tx_data_size = TX_DATA_SLICE_SIZE * (1LL + tx_data->undo_status_list_.undo_node_cnt_);
-    ATOMIC_FAA(&occupied_size_, tx_data_size);
+    ATOMIC_FAA(&local_info.occupied_size_, tx_data_size);
 
     // TODO : @gengli remove this after tx data memtable flush stable
     common::inc_update(&last_insert_ts_, ObTimeUtil::current_time_ns());
@@ -264,7 +280,7 @@ int ObTxDataMemtable::construct_list_for_sort_()
   int64_t sort_list_node_cnt = 0;
   int64_t skip_list_node_cnt = 0;
   for (int i = 0; i < MAX_TX_DATA_TABLE_CONCURRENCY; i++) {
-    cur_node = local_sort_list_head_[i].next_;
+    cur_node = local_insert_info_[i].sort_list_head_.next_;
     while (OB_NOT_NULL(cur_node)) {
       ObTxData *tx_data = ObTxData::get_tx_data_by_sort_list_node(cur_node);
 
@@ -291,17 +307,18 @@ int ObTxDataMemtable::construct_list_for_sort_()
     ret = OB_ERR_UNEXPECTED;
     STORAGE_LOG(ERROR, "Tx data is inserted after flushing is running.", KR(ret), K(start_construct_ts), K(last_insert_ts_), KPC(this));
   } else {
+    const int64_t inserted_cnt = get_inserted_count();
     bool node_cnt_correct = (skip_list_node_cnt == deleted_cnt_) 
-                          && (skip_list_node_cnt + sort_list_node_cnt == inserted_cnt_) 
+                          && (skip_list_node_cnt + sort_list_node_cnt == inserted_cnt) 
                           && (sort_list_node_cnt == tx_data_map_->count()) 
-                          && (inserted_cnt_ - deleted_cnt_ == tx_data_map_->count());
+                          && (inserted_cnt - deleted_cnt_ == tx_data_map_->count());
 
     if (!node_cnt_correct) {
     ret = OB_ERR_UNEXPECTED;
     STORAGE_LOG(ERROR,
         "sort list count is not equal to inserted tx data count",
         KR(ret),
-        K(inserted_cnt_),
+        K(inserted_cnt),
         K(deleted_cnt_),
         K(skip_list_node_cnt),
         K(sort_list_node_cnt),
@@ -708,10 +725,10 @@ int ObTxDataMemtable::dump2text(const char *fname)
         min_tx_log_ts_,
         max_tx_log_ts_,
         min_start_log_ts_,
-        inserted_cnt_,
+        get_inserted_count(),
         deleted_cnt_,
         write_ref_,
-        occupied_size_,
+        get_occupied_size(),
         last_insert_ts_,
         state_);
     fprintf(fd, "tx_data_count=%ld \n", tx_data_map_->count());
@@ -762,10 +779,10 @@ void ObTxDataMemtable::DEBUG_dump_sort_list_node_2_text(const char *fname)
         min_tx_log_ts_,
         max_tx_log_ts_,
         min_start_log_ts_,
-        inserted_cnt_,
+        get_inserted_count(),
         deleted_cnt_,
         write_ref_,
-        occupied_size_,
+        get_occupied_size(),
         last_insert_ts_,
         state_);
     fprintf(fd, "tx_data_count=%ld \n", tx_data_map_->count());
@@ -32,6 +32,23 @@ private:
   using SliceAllocator = ObSliceAlloc;
   static const int MAX_TX_DATA_TABLE_CONCURRENCY = 64;
 
+  // The part of the memtable written by every insert, one per thread slot and each on its own
+  // cache line, so that committing threads do not contend on the list heads and counters.
+  // Readers sum them up, which only happens on freeze, flush and diagnosis.
+  struct LocalInsertInfo
+  {
+    LocalInsertInfo() : sort_list_head_(), inserted_cnt_(0), occupied_size_(0) {}
+    void reset()
+    {
+      sort_list_head_.reset();
+      inserted_cnt_ = 0;
+      occupied_size_ = 0;
+    }
+    ObTxDataSortListNode sort_list_head_;
+    int64_t inserted_cnt_;
+    int64_t occupied_size_;
+  } CACHE_ALIGNED;
+
 public:
   // active   : freeze_ts is not set
   // freezing : freeze_ts is set, tx data is incomplete
@@ -59,10 +76,8 @@ public:  // ObTxDataMemtable
       min_tx_log_ts_(0),
       max_tx_log_ts_(0),
       min_start_log_ts_(0),
-      inserted_cnt_(0),
       deleted_cnt_(0),
       write_ref_(0),
-      occupied_size_(0),
       last_insert_ts_(0),
       state_(ObTxDataMemtable::State::INVALID),
       sort_list_head_(),
@@ -163,9 +178,9 @@ public:  // ObTxDataMemtable
                        K_(max_tx_log_ts),
                        K_(min_start_log_ts),
                        K_(snapshot_version),
-                       K_(inserted_cnt),
+                       "inserted_cnt", get_inserted_count(),
                        K_(write_ref),
-                       K_(occupied_size),
+                       "occupied_size", get_occupied_size(),
                        K_(state),
                        KP_(tx_data_map),
                        KP_(memtable_mgr));
@@ -208,7 +223,7 @@ public: /* derived from ObITable */
   virtual bool is_frozen_memtable() const { return ObTxDataMemtable::State::FROZEN == state_; }
 
 public: /* derived from ObIMemtable */
-  virtual int64_t get_occupied_size() const { return occupied_size_; }
+  virtual int64_t get_occupied_size() const;
 
   // not supported
   virtual int get(const storage::ObTableIterParam &param,
@@ -255,7 +270,7 @@ public:  // getter && setter
   int64_t get_min_start_log_ts() { return ATOMIC_LOAD(&min_start_log_ts_); }
   int64_t get_tx_data_count() { return tx_data_map_->count(); }
   int64_t size() { return get_tx_data_count(); }
-  int64_t get_inserted_count() { return inserted_cnt_; }
+  int64_t get_inserted_count() const;
   int64_t get_deleted_count() { return deleted_cnt_; }
   int64_t inc_write_ref() { return ATOMIC_AAF(&write_ref_, 1); }
   int64_t dec_write_ref() { return ATOMIC_AAF(&write_ref_, -1); }
@@ -310,14 +325,10 @@ private:  // ObTxDataMemtable
   // the minimum start log ts in this tx data memtable
   int64_t min_start_log_ts_;
 
-  int64_t inserted_cnt_;
-
   int64_t deleted_cnt_;
 
   int64_t write_ref_;
 
-  int64_t occupied_size_;
-
   int64_t last_insert_ts_;
 
   // the state of tx data memtable can be one of 4 kinds of state :
@@ -328,7 +339,7 @@ private:  // ObTxDataMemtable
   ObTxDataSortListNode sort_list_head_;
   // use thread local list instead of foreach of link hash map can speed up constructing list for
   // sort.
-  ObTxDataSortListNode local_sort_list_head_[MAX_TX_DATA_TABLE_CONCURRENCY];
+  LocalInsertInfo local_insert_info_[MAX_TX_DATA_TABLE_CONCURRENCY];
 
   // the hash map sotres tx data
   TxDataMap *tx_data_map_;
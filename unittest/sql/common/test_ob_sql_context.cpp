@@ -0,0 +1,115 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#include "sql/ob_sql_context.h"
+#include "sql/ob_sql_init.h"
+#include "lib/allocator/page_arena.h"
+#include "lib/container/ob_se_array.h"
+
+using namespace oceanbase;
+using namespace oceanbase::sql;
+using namespace oceanbase::common;
+namespace test
+{
+class TestSqlContext: public ::testing::Test
+{
+public:
+  TestSqlContext() {}
+  ~TestSqlContext() {}
+  // ObMPQuery keeps one ObSqlCtx for all statements of a multi-statement query
+  // and resets it after each of them, see ObMPQuery::process_single_stmt()
+  static void run_stmt(ObSqlCtx &ctx, const char *sql, const uint64_t stmt_id, ObIAllocator &allocator);
+  static void check_clean(const ObSqlCtx &ctx);
+};
+
+void TestSqlContext::run_stmt(ObSqlCtx &ctx, const char *sql, const uint64_t stmt_id, ObIAllocator &allocator)
+{
+  ObSEArray<ObString, 1> var_names;
+  ASSERT_EQ(OB_SUCCESS, var_names.push_back(ObString::make_string("v")));
+  ctx.cur_sql_ = ObString::make_string(sql);
+  ctx.statement_id_ = stmt_id;
+  ctx.exec_type_ = MpQuery;
+  ctx.retry_times_ = 1;
+  ctx.plan_cache_hit_ = true;
+  ctx.is_dbms_sql_ = true;
+  ctx.is_cursor_ = true;
+  ctx.is_sensitive_ = true;
+  ctx.stmt_type_ = stmt::T_SELECT;
+  STRNCPY(ctx.sql_id_, "0123456789ABCDEF0123456789ABCDEF", sizeof(ctx.sql_id_) - 1);
+  ASSERT_EQ(OB_SUCCESS, ctx.set_related_user_var_names(var_names, allocator));
+  ctx.spm_ctx_.set_get_normal_mode(stmt_id);
+  ctx.spm_ctx_.offset_ = 1;
+  ctx.spm_ctx_.need_sync_ = true;
+  ctx.spm_ctx_.is_retry_for_spm_ = true;
+  ctx.spm_ctx_.capture_baseline_ = true;
+  ctx.spm_ctx_.new_plan_hash_ = stmt_id;
+  ctx.spm_ctx_.spm_stat_ = ObSpmCacheCtx::STAT_ADD_EVOLUTION_PLAN;
+  ctx.spm_ctx_.cache_node_empty_ = false;
+  ctx.spm_ctx_.last_evolution_count_ = 1;
+  ctx.spm_ctx_.bl_key_.sql_id_ = ObString::make_string(ctx.sql_id_);
+}
+
+void TestSqlContext::check_clean(const ObSqlCtx &ctx)
+{
+  const ObSqlCtx fresh;
+  ASSERT_TRUE(ctx.cur_sql_.empty());
+  ASSERT_EQ(fresh.statement_id_, ctx.statement_id_);
+  ASSERT_EQ(fresh.retry_times_, ctx.retry_times_);
+  ASSERT_EQ(fresh.plan_cache_hit_, ctx.plan_cache_hit_);
+  ASSERT_EQ(fresh.is_dbms_sql_, ctx.is_dbms_sql_);
+  ASSERT_EQ(fresh.is_cursor_, ctx.is_cursor_);
+  ASSERT_EQ(fresh.is_sensitive_, ctx.is_sensitive_);
+  ASSERT_EQ(fresh.stmt_type_, ctx.stmt_type_);
+  ASSERT_EQ('\0', ctx.sql_id_[0]);
+  ASSERT_TRUE(ctx.related_user_var_names_.empty());
+  ASSERT_EQ(fresh.spm_ctx_.handle_cache_mode_, ctx.spm_ctx_.handle_cache_mode_);
+  ASSERT_EQ(fresh.spm_ctx_.plan_hash_value_, ctx.spm_ctx_.plan_hash_value_);
+  ASSERT_EQ(fresh.spm_ctx_.offset_, ctx.spm_ctx_.offset_);
+  ASSERT_EQ(fresh.spm_ctx_.need_sync_, ctx.spm_ctx_.need_sync_);
+  ASSERT_EQ(fresh.spm_ctx_.is_retry_for_spm_, ctx.spm_ctx_.is_retry_for_spm_);
+  ASSERT_EQ(fresh.spm_ctx_.capture_baseline_, ctx.spm_ctx_.capture_baseline_);
+  ASSERT_EQ(fresh.spm_ctx_.new_plan_hash_, ctx.spm_ctx_.new_plan_hash_);
+  ASSERT_EQ(fresh.spm_ctx_.spm_stat_, ctx.spm_ctx_.spm_stat_);
+  ASSERT_EQ(fresh.spm_ctx_.cache_node_empty_, ctx.spm_ctx_.cache_node_empty_);
+  ASSERT_EQ(fresh.spm_ctx_.last_evolution_count_, ctx.spm_ctx_.last_evolution_count_);
+  ASSERT_TRUE(ctx.spm_ctx_.bl_key_.sql_id_.empty());
+}
+
+TEST_F(TestSqlContext, reset_between_statements)
+{
+  ObArenaAllocator allocator;
+  ObSqlCtx ctx;
+  run_stmt(ctx, "select 1", 1, allocator);
+  ctx.reset();
+  check_clean(ctx);
+
+  // the second statement only sets part of the context, nothing of the first one may show through
+  ctx.cur_sql_ = ObString::make_string("select 2");
+  ASSERT_EQ(OB_INVALID_ID, ctx.statement_id_);
+  ASSERT_EQ(ObSpmCacheCtx::MODE_INVALID, ctx.spm_ctx_.handle_cache_mode_);
+  ASSERT_EQ(0, ctx.spm_ctx_.plan_hash_value_);
+  run_stmt(ctx, "select 2", 2, allocator);
+  ASSERT_EQ(0, ctx.cur_sql_.compare("select 2"));
+  ASSERT_EQ(2, ctx.spm_ctx_.plan_hash_value_);
+  ctx.reset();
+  check_clean(ctx);
+}
+}
+
+int main(int argc, char **argv)
+{
+  init_sql_factories();
+  OB_LOGGER.set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc,argv);
+  return RUN_ALL_TESTS();
+}
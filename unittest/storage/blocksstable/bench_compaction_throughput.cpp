@@ -0,0 +1,529 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+// Compaction write path throughput benchmark.
+//
+// Generates a synthetic multi-version tablet and pushes it through the same code a merge uses
+// to produce an sstable: ObRowFuse for major merge, the micro block writer/encoder,
+// ObMicroBlockCompressor, crc64 checksum and ObMacroBlockWriter against a local block file.
+//
+// It is a benchmark, not a unit test: the target is only built by `make storage_bench` and is
+// not registered with ctest. The defaults finish in seconds, scale them up with the flags.
+//
+// usage: ./bench_compaction_throughput [-r row_cnt] [-i int_col_cnt] [-s str_col_cnt] [-l str_len]
+//          [-c cardinality] [-u update_pct] [-d version_depth] [-m mini|minor|major]
+//          [-t flat|encoding] [-z compressor] [-b micro_block_size] [-n macro_block_cnt]
+
+#define USING_LOG_PREFIX STORAGE
+
+#include <getopt.h>
+#include <time.h>
+#include <gtest/gtest.h>
+#define private public
+#define protected public
+#include "ob_data_file_prepare.h"
+#include "lib/checksum/ob_crc64.h"
+#include "lib/string/ob_sql_string.h"
+#include "share/ob_simple_mem_limit_getter.h"
+#include "storage/blocksstable/ob_macro_block_writer.h"
+#include "storage/ob_row_fuse.h"
+#include "storage/ob_sstable_struct.h"
+
+namespace oceanbase
+{
+using namespace common;
+using namespace blocksstable;
+using namespace storage;
+using namespace share::schema;
+static ObSimpleMemLimitGetter getter;
+
+namespace unittest
+{
+
+struct ObCompactionBenchOption
+{
+  ObCompactionBenchOption()
+    : row_cnt_(100000),
+      int_column_cnt_(4),
+      str_column_cnt_(2),
+      str_length_(32),
+      cardinality_(1000),
+      update_pct_(20),
+      version_depth_(3),
+      merge_type_(MAJOR_MERGE),
+      row_store_type_(ENCODING_ROW_STORE),
+      compressor_name_("zstd_1.3.8"),
+      micro_block_size_(16 * 1024),
+      macro_block_cnt_(256)
+  {}
+  TO_STRING_KV(K_(row_cnt), K_(int_column_cnt), K_(str_column_cnt), K_(str_length), K_(cardinality),
+      K_(update_pct), K_(version_depth), K_(merge_type), K_(row_store_type), K_(compressor_name),
+      K_(micro_block_size), K_(macro_block_cnt));
+  int64_t row_cnt_;         // count of distinct rowkeys
+  int64_t int_column_cnt_;  // int columns besides the rowkey
+  int64_t str_column_cnt_;
+  int64_t str_length_;
+  int64_t cardinality_;     // distinct values per non-rowkey column
+  int64_t update_pct_;      // percent of rowkeys that have multiple versions
+  int64_t version_depth_;   // versions of an updated rowkey
+  ObMergeType merge_type_;
+  ObRowStoreType row_store_type_;
+  const char *compressor_name_;
+  int64_t micro_block_size_;
+  int64_t macro_block_cnt_;  // size of the local block file, in macro blocks
+};
+
+static ObCompactionBenchOption bench_option;
+
+struct ObCompactionBenchStat
+{
+  ObCompactionBenchStat() { MEMSET(this, 0, sizeof(*this)); }
+  void print(const ObCompactionBenchOption &option) const;
+  int64_t input_row_cnt_;
+  int64_t output_row_cnt_;
+  int64_t micro_block_cnt_;
+  int64_t macro_block_cnt_;
+  int64_t original_size_;
+  int64_t compressed_size_;
+  int64_t gen_us_;          // row generation including fuse, measured alone
+  int64_t gen_cpu_us_;
+  int64_t fuse_us_;
+  int64_t fuse_cpu_us_;
+  int64_t encode_us_;
+  int64_t compress_us_;
+  int64_t checksum_us_;
+  int64_t writer_us_;       // end to end through ObMacroBlockWriter
+  int64_t writer_cpu_us_;
+};
+
+void ObCompactionBenchStat::print(const ObCompactionBenchOption &option) const
+{
+  const double writer_sec = MAX(writer_us_, 1) / 1000000.0;
+  const double mb = 1024.0 * 1024.0;
+  // whatever the writer spends beyond encode/compress/checksum: index rows, block switch, io
+  const int64_t write_us = MAX(0, writer_us_ - encode_us_ - compress_us_ - checksum_us_);
+  fprintf(stdout, "option: %s\n", to_cstring(option));
+  fprintf(stdout, "rows: input=%ld output=%ld micro_blocks=%ld macro_blocks=%ld\n",
+      input_row_cnt_, output_row_cnt_, micro_block_cnt_, macro_block_cnt_);
+  fprintf(stdout, "throughput: %.2f rows/s, %.2f MB/s (original), %.2f MB/s (written)\n",
+      output_row_cnt_ / writer_sec, original_size_ / mb / writer_sec, compressed_size_ / mb / writer_sec);
+  fprintf(stdout, "compression ratio: %.3f (%ld -> %ld)\n",
+      compressed_size_ > 0 ? static_cast<double>(original_size_) / compressed_size_ : 0.0,
+      original_size_, compressed_size_);
+  if (is_major_merge(option.merge_type_)) {
+    fprintf(stdout, "fuse us: wall=%ld cpu=%ld\n", fuse_us_, fuse_cpu_us_);
+  } else {
+    // the minor merge compacts the versions of a row in the multi-version row scanner,
+    // which needs real sstables, the rows are written as generated
+    fprintf(stdout, "fuse: not run, %s merge writes the generated multi-version rows as is\n",
+        merge_type_to_str(option.merge_type_));
+  }
+  fprintf(stdout, "phase us: encode=%ld compress=%ld checksum=%ld write=%ld writer_total=%ld writer_cpu=%ld\n",
+      encode_us_, compress_us_, checksum_us_, write_us, writer_us_, writer_cpu_us_);
+}
+
+static int64_t get_thread_cpu_us()
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+  return ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+class ObCompactionBench : public TestDataFilePrepare
+{
+public:
+  ObCompactionBench()
+    : TestDataFilePrepare(&getter, "compaction_bench", OB_DEFAULT_MACRO_BLOCK_SIZE,
+                          bench_option.macro_block_cnt_),
+      option_(bench_option),
+      table_schema_(),
+      data_desc_(),
+      merge_info_(),
+      str_buf_(nullptr),
+      time_fuse_(false)
+  {}
+  virtual ~ObCompactionBench() {}
+  virtual void SetUp();
+  virtual void TearDown();
+protected:
+  int64_t get_version_cnt(const int64_t key) const;
+  void fill_row(const int64_t key, const int64_t version, const bool is_full_row, ObDatumRow &row);
+  int generate_key_rows(const int64_t key, ObCompactionBenchStat &stat, ObIArray<ObDatumRow *> &rows);
+  void bench_generate(ObCompactionBenchStat &stat);
+  void bench_phases(ObCompactionBenchStat &stat);
+  void bench_macro_writer(ObCompactionBenchStat &stat);
+protected:
+  static const int64_t BENCH_TABLE_ID = 50001;
+  static const int64_t TABLET_ID = 50001;
+  static const int64_t LS_ID = 1001;
+  static const int64_t SNAPSHOT_VERSION = 1000;
+  static const int64_t ROWKEY_COLUMN_CNT = 1;
+  static const int64_t MAX_VERSION_DEPTH = 64;
+  const ObCompactionBenchOption &option_;
+  ObTableSchema table_schema_;
+  ObDataStoreDesc data_desc_;
+  ObSSTableMergeInfo merge_info_;
+  ObDatumRow version_rows_[MAX_VERSION_DEPTH];
+  ObDatumRow fused_row_;
+  ObNopPos nop_pos_;
+  char *str_buf_;
+  bool time_fuse_;
+};
+
+void ObCompactionBench::SetUp()
+{
+  TestDataFilePrepare::SetUp();
+  const int64_t column_cnt = ROWKEY_COLUMN_CNT + option_.int_column_cnt_ + option_.str_column_cnt_;
+  ASSERT_TRUE(option_.version_depth_ > 0 && option_.version_depth_ <= MAX_VERSION_DEPTH);
+  ASSERT_EQ(OB_SUCCESS, table_schema_.set_table_name("compaction_bench"));
+  table_schema_.set_tenant_id(TENANT_ID);
+  table_schema_.set_tablegroup_id(1);
+  table_schema_.set_database_id(1);
+  table_schema_.set_table_id(BENCH_TABLE_ID);
+  table_schema_.set_rowkey_column_num(ROWKEY_COLUMN_CNT);
+  table_schema_.set_max_used_column_id(OB_APP_MIN_COLUMN_ID + column_cnt);
+  table_schema_.set_block_size(option_.micro_block_size_);
+  table_schema_.set_compress_func_name(option_.compressor_name_);
+  table_schema_.set_row_store_type(option_.row_store_type_);
+  table_schema_.set_storage_format_version(OB_STORAGE_FORMAT_VERSION_V4);
+
+  ObColumnSchemaV2 column;
+  ObSqlString name;
+  for (int64_t i = 0; i < column_cnt; ++i) {
+    column.reset();
+    column.set_table_id(BENCH_TABLE_ID);
+    column.set_column_id(OB_APP_MIN_COLUMN_ID + i);
+    ASSERT_EQ(OB_SUCCESS, name.assign_fmt("c%ld", i));
+    ASSERT_EQ(OB_SUCCESS, column.set_column_name(name.ptr()));
+    column.set_rowkey_position(i < ROWKEY_COLUMN_CNT ? i + 1 : 0);
+    column.set_collation_type(CS_TYPE_UTF8MB4_BIN);
+    if (i < ROWKEY_COLUMN_CNT + option_.int_column_cnt_) {
+      column.set_data_type(ObIntType);
+    } else {
+      column.set_data_type(ObVarcharType);
+      column.set_data_length(option_.str_length_);
+    }
+    ASSERT_EQ(OB_SUCCESS, table_schema_.add_column(column));
+  }
+
+  ASSERT_EQ(OB_SUCCESS, data_desc_.init(table_schema_, ObLSID(LS_ID), ObTabletID(TABLET_ID),
+      option_.merge_type_, SNAPSHOT_VERSION, CLUSTER_VERSION_4_0_0_0));
+  merge_info_.merge_type_ = option_.merge_type_;
+  data_desc_.merge_info_ = &merge_info_;
+  ASSERT_TRUE(data_desc_.is_valid());
+
+  for (int64_t i = 0; i < option_.version_depth_; ++i) {
+    ASSERT_EQ(OB_SUCCESS, version_rows_[i].init(allocator_, data_desc_.row_column_count_));
+  }
+  ASSERT_EQ(OB_SUCCESS, fused_row_.init(allocator_, data_desc_.row_column_count_));
+  ASSERT_EQ(OB_SUCCESS, nop_pos_.init(allocator_, data_desc_.row_column_count_));
+  // every string column value is a window of this buffer, so the cardinality is controlled by the offset
+  ASSERT_NE(nullptr, str_buf_ = static_cast<char *>(allocator_.alloc(option_.cardinality_ + option_.str_length_)));
+  for (int64_t i = 0; i < option_.cardinality_ + option_.str_length_; ++i) {
+    str_buf_[i] = static_cast<char>('a' + murmurhash(&i, sizeof(i), 0) % 26);
+  }
+}
+
+void ObCompactionBench::TearDown()
+{
+  data_desc_.reset();
+  TestDataFilePrepare::TearDown();
+}
+
+int64_t ObCompactionBench::get_version_cnt(const int64_t key) const
+{
+  const uint64_t hash = murmurhash(&key, sizeof(key), 0);
+  return static_cast<int64_t>(hash % 100) < option_.update_pct_ ? option_.version_depth_ : 1;
+}
+
+// the oldest version of a rowkey is the full inserted row, newer versions of an updated
+// rowkey only touch one column and leave the others nop, as the memtable would dump them
+void ObCompactionBench::fill_row(
+    const int64_t key,
+    const int64_t version,
+    const bool is_full_row,
+    ObDatumRow &row)
+{
+  const int64_t schema_rowkey_cnt = ROWKEY_COLUMN_CNT;
+  const int64_t column_cnt = table_schema_.get_column_count();
+  const int64_t updated_col = schema_rowkey_cnt + (key + version) % (column_cnt - schema_rowkey_cnt);
+  row.row_flag_.set_flag(is_full_row ? ObDmlFlag::DF_INSERT : ObDmlFlag::DF_UPDATE);
+  row.mvcc_row_flag_.reset();
+  row.storage_datums_[0].reuse();
+  row.storage_datums_[0].set_int(key);
+  row.storage_datums_[schema_rowkey_cnt].reuse();
+  row.storage_datums_[schema_rowkey_cnt].set_int(-version);
+  row.storage_datums_[schema_rowkey_cnt + 1].reuse();
+  row.storage_datums_[schema_rowkey_cnt + 1].set_int(0);
+  for (int64_t i = schema_rowkey_cnt; i < column_cnt; ++i) {
+    ObStorageDatum &datum = row.storage_datums_[i + ObMultiVersionRowkeyHelpper::get_extra_rowkey_col_cnt()];
+    const int64_t seed = key * 31 + i * 7 + version;
+    const int64_t value = murmurhash(&seed, sizeof(seed), 0) % option_.cardinality_;
+    if (!is_full_row && i != updated_col) {
+      datum.set_nop();
+    } else if (i < schema_rowkey_cnt + option_.int_column_cnt_) {
+      datum.reuse();
+      datum.set_int(value);
+    } else {
+      datum.set_string(str_buf_ + value, option_.str_length_);
+    }
+  }
+  row.count_ = data_desc_.row_column_count_;
+}
+
+int ObCompactionBench::generate_key_rows(
+    const int64_t key,
+    ObCompactionBenchStat &stat,
+    ObIArray<ObDatumRow *> &rows)
+{
+  int ret = OB_SUCCESS;
+  const int64_t version_cnt = get_version_cnt(key);
+  rows.reuse();
+  for (int64_t i = 0; i < version_cnt; ++i) {
+    // newest version first, as multi-version rows are sorted by descending trans version
+    const int64_t version = SNAPSHOT_VERSION - i;
+    fill_row(key, version, i == version_cnt - 1, version_rows_[i]);
+  }
+  if (is_major_merge(option_.merge_type_)) {
+    // timing every key costs two clock reads, only bench_generate asks for it
+    const int64_t start_us = time_fuse_ ? ObTimeUtility::current_time() : 0;
+    const int64_t start_cpu_us = time_fuse_ ? get_thread_cpu_us() : 0;
+    bool final_result = false;
+    nop_pos_.reset();
+    fused_row_.row_flag_.reset();
+    fused_row_.count_ = data_desc_.row_column_count_;
+    for (int64_t i = 0; i < data_desc_.row_column_count_; ++i) {
+      fused_row_.storage_datums_[i].set_nop();
+    }
+    for (int64_t i = 0; OB_SUCC(ret) && !final_result && i < version_cnt; ++i) {
+      if (OB_FAIL(ObRowFuse::fuse_row(version_rows_[i], fused_row_, nop_pos_, final_result))) {
+        STORAGE_LOG(WARN, "failed to fuse row", K(ret), K(i), K(version_rows_[i]));
+      }
+    }
+    if (OB_SUCC(ret)) {
+      fused_row_.mvcc_row_flag_.reset();
+      fused_row_.set_compacted_multi_version_row();
+      fused_row_.set_first_multi_version_row();
+      fused_row_.set_last_multi_version_row();
+      ret = rows.push_back(&fused_row_);
+    }
+    if (time_fuse_) {
+      stat.fuse_us_ += ObTimeUtility::current_time() - start_us;
+      stat.fuse_cpu_us_ += get_thread_cpu_us() - start_cpu_us;
+    }
+  } else {
+    for (int64_t i = 0; OB_SUCC(ret) && i < version_cnt; ++i) {
+      ObDatumRow &row = version_rows_[i];
+      if (0 == i) {
+        row.set_first_multi_version_row();
+      }
+      if (version_cnt - 1 == i) {
+        row.set_compacted_multi_version_row();
+        row.set_last_multi_version_row();
+      }
+      ret = rows.push_back(&row);
+    }
+  }
+  return ret;
+}
+
+// row generation alone, its cost is taken out of the writer numbers, then once more
+// with the fuse of every key timed
+void ObCompactionBench::bench_generate(ObCompactionBenchStat &stat)
+{
+  ObSEArray<ObDatumRow *, 64> rows;
+  ObCompactionBenchStat gen_stat;
+  const int64_t start_cpu_us = get_thread_cpu_us();
+  const int64_t start_us = ObTimeUtility::current_time();
+  for (int64_t key = 0; key < option_.row_cnt_; ++key) {
+    ASSERT_EQ(OB_SUCCESS, generate_key_rows(key, gen_stat, rows));
+  }
+  stat.gen_us_ = ObTimeUtility::current_time() - start_us;
+  stat.gen_cpu_us_ = get_thread_cpu_us() - start_cpu_us;
+  if (is_major_merge(option_.merge_type_)) {
+    time_fuse_ = true;
+    for (int64_t key = 0; key < option_.row_cnt_; ++key) {
+      ASSERT_EQ(OB_SUCCESS, generate_key_rows(key, stat, rows));
+    }
+    time_fuse_ = false;
+  }
+}
+
+// encode, compress and checksum in isolation, the way ObMacroBlockWriter::build_micro_block does
+void ObCompactionBench::bench_phases(ObCompactionBenchStat &stat)
+{
+  ObArenaAllocator allocator;
+  ObIMicroBlockWriter *micro_writer = nullptr;
+  ObMicroBlockCompressor compressor;
+  ObSEArray<ObDatumRow *, 64> rows;
+  ASSERT_EQ(OB_SUCCESS, ObMacroBlockWriter::build_micro_writer(&data_desc_, allocator, micro_writer,
+      MICRO_BLOCK_MERGE_VERIFY_LEVEL::NONE));
+  ASSERT_EQ(OB_SUCCESS, compressor.init(data_desc_.micro_block_size_, data_desc_.compressor_type_));
+
+  int64_t encode_us = 0;
+  auto flush_micro_block = [&]() {
+    ObMicroBlockDesc micro_desc;
+    const char *comp_buf = nullptr;
+    int64_t comp_size = 0;
+    int64_t start_us = ObTimeUtility::current_time();
+    ASSERT_EQ(OB_SUCCESS, micro_writer->build_micro_block_desc(micro_desc));
+    stat.encode_us_ += encode_us + ObTimeUtility::current_time() - start_us;
+    encode_us = 0;
+    start_us = ObTimeUtility::current_time();
+    ASSERT_EQ(OB_SUCCESS, compressor.compress(micro_desc.buf_, micro_desc.buf_size_, comp_buf, comp_size));
+    stat.compress_us_ += ObTimeUtility::current_time() - start_us;
+    start_us = ObTimeUtility::current_time();
+    const int64_t checksum = ob_crc64_sse42(0, comp_buf, comp_size);
+    stat.checksum_us_ += ObTimeUtility::current_time() - start_us;
+    UNUSED(checksum);
+    ++stat.micro_block_cnt_;
+    micro_writer->reuse();
+  };
+
+  for (int64_t key = 0; key < option_.row_cnt_; ++key) {
+    ASSERT_EQ(OB_SUCCESS, generate_key_rows(key, stat, rows));
+    for (int64_t i = 0; i < rows.count(); ++i) {
+      const int64_t start_us = ObTimeUtility::current_time();
+      int ret = micro_writer->append_row(*rows.at(i));
+      if (OB_BUF_NOT_ENOUGH == ret) {
+        encode_us += ObTimeUtility::current_time() - start_us;
+        flush_micro_block();
+        ret = micro_writer->append_row(*rows.at(i));
+      }
+      ASSERT_EQ(OB_SUCCESS, ret);
+      encode_us += ObTimeUtility::current_time() - start_us;
+      if (micro_writer->get_block_size() >= data_desc_.micro_block_size_) {
+        flush_micro_block();
+      }
+    }
+  }
+  if (micro_writer->get_row_count() > 0) {
+    flush_micro_block();
+  }
+  micro_writer->~ObIMicroBlockWriter();
+}
+
+void ObCompactionBench::bench_macro_writer(ObCompactionBenchStat &stat)
+{
+  ObMacroBlockWriter writer;
+  ObMacroDataSeq start_seq(0);
+  ObSEArray<ObDatumRow *, 64> rows;
+  ObCompactionBenchStat gen_stat;
+  start_seq.set_data_block();
+  ASSERT_EQ(OB_SUCCESS, writer.open(data_desc_, start_seq));
+
+  const int64_t start_cpu_us = get_thread_cpu_us();
+  const int64_t start_us = ObTimeUtility::current_time();
+  for (int64_t key = 0; key < option_.row_cnt_; ++key) {
+    ASSERT_EQ(OB_SUCCESS, generate_key_rows(key, gen_stat, rows));
+    // rows are generated by every pass, only count the input of the measured one
+    stat.input_row_cnt_ += get_version_cnt(key);
+    for (int64_t i = 0; i < rows.count(); ++i) {
+      ASSERT_EQ(OB_SUCCESS, writer.append_row(*rows.at(i)));
+      ++stat.output_row_cnt_;
+    }
+  }
+  ASSERT_EQ(OB_SUCCESS, writer.close());
+  // row generation and fuse are measured by bench_generate, keep them out of the writer numbers
+  stat.writer_us_ = MAX(0, ObTimeUtility::current_time() - start_us - stat.gen_us_);
+  stat.writer_cpu_us_ = MAX(0, get_thread_cpu_us() - start_cpu_us - stat.gen_cpu_us_);
+  stat.macro_block_cnt_ = writer.get_macro_block_write_ctx().get_macro_block_count();
+  stat.original_size_ = merge_info_.original_size_;
+  stat.compressed_size_ = merge_info_.compressed_size_;
+}
+
+TEST_F(ObCompactionBench, bench_compaction_throughput)
+{
+  ObCompactionBenchStat stat;
+  bench_generate(stat);
+  bench_phases(stat);
+  bench_macro_writer(stat);
+  STORAGE_LOG(INFO, "compaction bench finished", K_(option), "row_store_type", data_desc_.row_store_type_,
+      "compressor_type", data_desc_.compressor_type_);
+  stat.print(option_);
+}
+
+static int parse_merge_type(const char *str, ObMergeType &merge_type)
+{
+  int ret = OB_SUCCESS;
+  if (0 == STRCMP(str, "mini")) {
+    merge_type = MINI_MERGE;
+  } else if (0 == STRCMP(str, "minor")) {
+    merge_type = MINOR_MERGE;
+  } else if (0 == STRCMP(str, "major")) {
+    merge_type = MAJOR_MERGE;
+  } else {
+    ret = OB_INVALID_ARGUMENT;
+  }
+  return ret;
+}
+
+static int parse_row_store_type(const char *str, ObRowStoreType &row_store_type)
+{
+  int ret = OB_SUCCESS;
+  if (0 == STRCMP(str, "flat")) {
+    row_store_type = FLAT_ROW_STORE;
+  } else if (0 == STRCMP(str, "encoding")) {
+    row_store_type = ENCODING_ROW_STORE;
+  } else {
+    ret = OB_INVALID_ARGUMENT;
+  }
+  return ret;
+}
+
+static int parse_option(int argc, char **argv, ObCompactionBenchOption &option)
+{
+  int ret = OB_SUCCESS;
+  int c = 0;
+  while (OB_SUCC(ret) && -1 != (c = getopt(argc, argv, "r:i:s:l:c:u:d:m:t:z:b:n:"))) {
+    switch (c) {
+      case 'r': option.row_cnt_ = atol(optarg); break;
+      case 'i': option.int_column_cnt_ = atol(optarg); break;
+      case 's': option.str_column_cnt_ = atol(optarg); break;
+      case 'l': option.str_length_ = atol(optarg); break;
+      case 'c': option.cardinality_ = atol(optarg); break;
+      case 'u': option.update_pct_ = atol(optarg); break;
+      case 'd': option.version_depth_ = atol(optarg); break;
+      case 'm': ret = parse_merge_type(optarg, option.merge_type_); break;
+      case 't': ret = parse_row_store_type(optarg, option.row_store_type_); break;
+      case 'z': option.compressor_name_ = optarg; break;
+      case 'b': option.micro_block_size_ = atol(optarg); break;
+      case 'n': option.macro_block_cnt_ = atol(optarg); break;
+      default: ret = OB_INVALID_ARGUMENT; break;
+    }
+  }
+  if (OB_SUCC(ret) && (option.row_cnt_ <= 0 || option.int_column_cnt_ + option.str_column_cnt_ <= 0
+      || option.str_length_ <= 0 || option.cardinality_ <= 0 || option.update_pct_ < 0
+      || option.update_pct_ > 100 || option.version_depth_ <= 0 || option.version_depth_ > 64
+      || option.micro_block_size_ <= 0 || option.macro_block_cnt_ <= 0)) {
+    ret = OB_INVALID_ARGUMENT;
+  }
+  return ret;
+}
+
+} // end namespace unittest
+} // end namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -f bench_compaction_throughput.log*");
+  OB_LOGGER.set_file_name("bench_compaction_throughput.log");
+  OB_LOGGER.set_log_level("WARN");
+  testing::InitGoogleTest(&argc, argv);
+  if (OB_SUCCESS != oceanbase::unittest::parse_option(argc, argv, oceanbase::unittest::bench_option)) {
+    fprintf(stderr, "usage: %s [-r row_cnt] [-i int_col_cnt] [-s str_col_cnt] [-l str_len] [-c cardinality]"
+        " [-u update_pct] [-d version_depth] [-m mini|minor|major] [-t flat|encoding] [-z compressor]"
+        " [-b micro_block_size] [-n macro_block_cnt]\n", argv[0]);
+    return 1;
+  }
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,434 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX STORAGE
+
+#include <gtest/gtest.h>
+#define protected public
+#define private public
+#include "storage/blocksstable/ob_decoded_column_cache.h"
+#include "storage/blocksstable/encoding/ob_micro_block_encoder.h"
+#include "storage/blocksstable/encoding/ob_micro_block_decoder.h"
+#include "storage/access/ob_table_read_info.h"
+#include "storage/access/ob_vector_store.h"
+#include "storage/blocksstable/ob_storage_cache_suite.h"
+#include "sql/engine/ob_exec_context.h"
+#include "share/rc/ob_tenant_base.h"
+#include "share/ob_simple_mem_limit_getter.h"
+#include "lib/checksum/ob_crc64.h"
+#include "lib/container/ob_se_array.h"
+
+namespace oceanbase
+{
+using namespace common;
+using namespace blocksstable;
+using namespace storage;
+using namespace share;
+using namespace share::schema;
+
+namespace unittest
+{
+class TestDecodedColumnCache : public ::testing::Test
+{
+public:
+  TestDecodedColumnCache() = default;
+  void SetUp() {}
+  void TearDown() {}
+  static void SetUpTestCase() {}
+  static void TearDownTestCase() {}
+};
+
+class TestDecodedColumnCacheScan : public ::testing::Test
+{
+public:
+  static const int64_t COLUMN_CNT = 3;
+  static const int64_t ROW_CNT = 100;
+  static const int64_t RES_BUF_LEN = 64;
+  TestDecodedColumnCacheScan() = default;
+  virtual void SetUp();
+  virtual void TearDown();
+  void build_block(const int64_t seed, ObMicroBlockData &block_data);
+  void decode_block(const ObMicroBlockData &block_data, ObDatum **columns);
+  void prepare_vector_store(ObVectorStore &store, sql::ObExpr *exprs, const int64_t frame_size);
+  static ObSimpleMemLimitGetter getter_;
+protected:
+  ObArray<ObColDesc> col_descs_;
+  ObSEArray<int32_t, COLUMN_CNT> cols_projector_;
+  ObSEArray<const ObColumnParam *, COLUMN_CNT> col_params_;
+  ObTableReadInfo read_info_;
+  ObMicroBlockEncodingCtx ctx_;
+  ObMicroBlockEncoder encoder_;
+  ObDecodedColumnCache cache_;
+  ObArenaAllocator allocator_;
+};
+ObSimpleMemLimitGetter TestDecodedColumnCacheScan::getter_;
+
+void TestDecodedColumnCacheScan::SetUp()
+{
+  int ret = getter_.add_tenant(OB_SYS_TENANT_ID, 2L * 1024L * 1024L * 1024L, 4L * 1024L * 1024L * 1024L);
+  ASSERT_TRUE(OB_SUCCESS == ret || OB_HASH_EXIST == ret || OB_ENTRY_EXIST == ret);
+  ret = ObKVGlobalCache::get_instance().init(&getter_, 1024, 512L * 1024L * 1024L);
+  ASSERT_TRUE(OB_SUCCESS == ret || OB_INIT_TWICE == ret);
+  ASSERT_EQ(OB_SUCCESS, cache_.init("decoded_column_cache", 1));
+
+  ObColDesc col_desc;
+  for (int64_t i = 0; i < COLUMN_CNT; ++i) {
+    col_desc.col_id_ = static_cast<uint64_t>(OB_APP_MIN_COLUMN_ID + i);
+    if (COLUMN_CNT - 1 == i) {
+      col_desc.col_type_.set_varchar();
+      col_desc.col_type_.set_collation_type(CS_TYPE_UTF8MB4_GENERAL_CI);
+    } else {
+      col_desc.col_type_.set_int();
+    }
+    ASSERT_EQ(OB_SUCCESS, col_descs_.push_back(col_desc));
+    ASSERT_EQ(OB_SUCCESS, cols_projector_.push_back(static_cast<int32_t>(i)));
+    ASSERT_EQ(OB_SUCCESS, col_params_.push_back(nullptr));
+  }
+  ASSERT_EQ(OB_SUCCESS, read_info_.init(allocator_, COLUMN_CNT, 1, lib::is_oracle_mode(), col_descs_));
+
+  ctx_.micro_block_size_ = 64L << 10;
+  ctx_.macro_block_size_ = 2L << 20;
+  ctx_.rowkey_column_cnt_ = 1;
+  ctx_.column_cnt_ = COLUMN_CNT;
+  ctx_.col_descs_ = &col_descs_;
+  ctx_.row_store_type_ = ENCODING_ROW_STORE;
+  ASSERT_EQ(OB_SUCCESS, encoder_.init(ctx_));
+}
+
+void TestDecodedColumnCacheScan::TearDown()
+{
+  cache_.destroy();
+  encoder_.reset();
+  allocator_.reset();
+}
+
+// encode ROW_CNT rows, every block has the same row count and only the values depend on seed
+void TestDecodedColumnCacheScan::build_block(const int64_t seed, ObMicroBlockData &block_data)
+{
+  ObDatumRow row;
+  char str_buf[32];
+  ASSERT_EQ(OB_SUCCESS, row.init(allocator_, COLUMN_CNT));
+  encoder_.reuse();
+  for (int64_t i = 0; i < ROW_CNT; ++i) {
+    const int64_t len = snprintf(str_buf, sizeof(str_buf), "value_%ld_%ld", seed, i);
+    row.storage_datums_[0].set_int(i);
+    row.storage_datums_[1].set_int(seed * ROW_CNT + i);
+    row.storage_datums_[2].set_string(str_buf, static_cast<int32_t>(len));
+    ASSERT_EQ(OB_SUCCESS, encoder_.append_row(row));
+  }
+  char *buf = nullptr;
+  int64_t size = 0;
+  ASSERT_EQ(OB_SUCCESS, encoder_.build_block(buf, size));
+  char *block_buf = static_cast<char *>(allocator_.alloc(size));
+  ASSERT_NE(nullptr, block_buf);
+  MEMCPY(block_buf, buf, size);
+  // fill the data checksum like the macro block writer does for an uncompressed block
+  ObMicroBlockHeader *header = reinterpret_cast<ObMicroBlockHeader *>(block_buf);
+  header->data_checksum_ = ob_crc64_sse42(0, block_buf + header->header_size_, size - header->header_size_);
+  header->set_header_checksum();
+  block_data.buf_ = block_buf;
+  block_data.size_ = size;
+}
+
+void TestDecodedColumnCacheScan::decode_block(const ObMicroBlockData &block_data, ObDatum **columns)
+{
+  ObMicroBlockDecoder decoder;
+  int64_t row_ids[ROW_CNT];
+  const char *cell_datas[ROW_CNT];
+  ObSEArray<ObDatum *, COLUMN_CNT> column_datums;
+  ASSERT_EQ(OB_SUCCESS, decoder.init(block_data, read_info_));
+  ASSERT_EQ(ROW_CNT, decoder.row_count());
+  for (int64_t i = 0; i < ROW_CNT; ++i) {
+    row_ids[i] = i;
+  }
+  // the decoders write fixed length values in place, give every datum its own buffer
+  for (int64_t i = 0; i < COLUMN_CNT; ++i) {
+    columns[i] = static_cast<ObDatum *>(allocator_.alloc(sizeof(ObDatum) * ROW_CNT));
+    char *res_buf = static_cast<char *>(allocator_.alloc(RES_BUF_LEN * ROW_CNT));
+    ASSERT_NE(nullptr, columns[i]);
+    ASSERT_NE(nullptr, res_buf);
+    for (int64_t j = 0; j < ROW_CNT; ++j) {
+      new (columns[i] + j) ObDatum();
+      columns[i][j].ptr_ = res_buf + RES_BUF_LEN * j;
+    }
+    ASSERT_EQ(OB_SUCCESS, column_datums.push_back(columns[i]));
+  }
+  ASSERT_EQ(OB_SUCCESS, decoder.get_rows(cols_projector_, col_params_, row_ids, cell_datas,
+                                         ROW_CNT, column_datums));
+}
+
+// set up the store the way ObVectorStore::init() does for COLUMN_CNT output exprs, each
+// with its batch datums and result buffers in the only frame of the eval ctx
+void TestDecodedColumnCacheScan::prepare_vector_store(
+    ObVectorStore &store,
+    sql::ObExpr *exprs,
+    const int64_t frame_size)
+{
+  ObIAllocator &stmt_allocator = *store.context_.stmt_allocator_;
+  char *frame = static_cast<char *>(allocator_.alloc(frame_size));
+  char **frames = static_cast<char **>(allocator_.alloc(sizeof(char *)));
+  int64_t *row_ids = static_cast<int64_t *>(stmt_allocator.alloc(sizeof(int64_t) * ROW_CNT));
+  ASSERT_NE(nullptr, frame);
+  ASSERT_NE(nullptr, frames);
+  ASSERT_NE(nullptr, row_ids);
+  MEMSET(frame, 0, frame_size);
+  frames[0] = frame;
+  store.eval_ctx_.frames_ = frames;
+  ASSERT_EQ(OB_SUCCESS, store.exprs_.init(COLUMN_CNT));
+  ASSERT_EQ(OB_SUCCESS, store.cols_projector_.init(COLUMN_CNT));
+  ASSERT_EQ(OB_SUCCESS, store.datums_.init(COLUMN_CNT));
+  ASSERT_EQ(OB_SUCCESS, store.col_params_.init(COLUMN_CNT));
+  int64_t offset = 0;
+  for (int64_t i = 0; i < COLUMN_CNT; ++i) {
+    sql::ObExpr &expr = exprs[i];
+    expr.frame_idx_ = 0;
+    expr.datum_off_ = static_cast<uint32_t>(offset);
+    offset += sizeof(ObDatum) * ROW_CNT;
+    expr.res_buf_off_ = static_cast<uint32_t>(offset);
+    expr.res_buf_len_ = RES_BUF_LEN;
+    offset += RES_BUF_LEN * ROW_CNT;
+    expr.obj_datum_map_ = COLUMN_CNT - 1 == i ? OBJ_DATUM_STRING : OBJ_DATUM_8BYTE_DATA;
+    ASSERT_EQ(OB_SUCCESS, store.exprs_.push_back(&expr));
+    ASSERT_EQ(OB_SUCCESS, store.cols_projector_.push_back(cols_projector_.at(i)));
+    ASSERT_EQ(OB_SUCCESS, store.datums_.push_back(expr.locate_batch_datums(store.eval_ctx_)));
+    ASSERT_EQ(OB_SUCCESS, store.col_params_.push_back(nullptr));
+  }
+  ASSERT_LE(offset, frame_size);
+  store.batch_size_ = ROW_CNT;
+  store.row_ids_ = row_ids;
+  store.enable_decoded_cache_ = true;
+  store.is_inited_ = true;
+}
+
+TEST_F(TestDecodedColumnCache, key)
+{
+  MacroBlockId macro_id(0, 1, 0);
+  ObSEArray<int32_t, 4> cols;
+  ASSERT_EQ(OB_SUCCESS, cols.push_back(3));
+  ASSERT_EQ(OB_SUCCESS, cols.push_back(1));
+  ObDecodedColumnCacheKey key(1001, macro_id, 12345, 100, cols);
+  ASSERT_TRUE(key.is_valid());
+
+  char buf[256];
+  ObIKVCacheKey *copy = nullptr;
+  ASSERT_EQ(OB_INVALID_ARGUMENT, key.deep_copy(buf, key.size() - 1, copy));
+  ASSERT_EQ(OB_SUCCESS, key.deep_copy(buf, sizeof(buf), copy));
+  ASSERT_NE(nullptr, copy);
+  // the copy must not reference the projector of the caller
+  cols.at(0) = 2;
+
+  bool equal = false;
+  uint64_t hash_value = 0;
+  uint64_t copy_hash_value = 0;
+  ObDecodedColumnCacheKey other(1001, macro_id, 12345, 100, cols);
+  ASSERT_EQ(OB_SUCCESS, copy->equal(other, equal));
+  ASSERT_FALSE(equal);
+  cols.at(0) = 3;
+  ASSERT_EQ(OB_SUCCESS, copy->equal(other, equal));
+  ASSERT_TRUE(equal);
+  ASSERT_EQ(OB_SUCCESS, copy->hash(copy_hash_value));
+  ASSERT_EQ(OB_SUCCESS, other.hash(hash_value));
+  ASSERT_EQ(hash_value, copy_hash_value);
+
+  ObDecodedColumnCacheKey other_block(1001, macro_id, 54321, 100, cols);
+  ASSERT_EQ(OB_SUCCESS, copy->equal(other_block, equal));
+  ASSERT_FALSE(equal);
+}
+
+TEST_F(TestDecodedColumnCache, value)
+{
+  const int64_t row_count = 4;
+  const char *strs[row_count] = {"a", "bb", nullptr, "dddd"};
+  int64_t ints[row_count] = {1, 2, 3, 4};
+  int64_t int_bufs[row_count] = {0};
+  ObDatum int_col[row_count];
+  ObDatum str_col[row_count];
+  for (int64_t i = 0; i < row_count; ++i) {
+    int_col[i].ptr_ = reinterpret_cast<const char *>(&int_bufs[i]);
+    int_col[i].set_int(ints[i]);
+    if (nullptr == strs[i]) {
+      str_col[i].set_null();
+    } else {
+      str_col[i].set_string(strs[i], static_cast<int32_t>(strlen(strs[i])));
+    }
+  }
+  ObDatum *columns[2] = {int_col, str_col};
+  ObDecodedColumnCacheValue value;
+  ASSERT_EQ(OB_INVALID_ARGUMENT, value.init(nullptr, 2, row_count));
+  ASSERT_EQ(OB_SUCCESS, value.init(columns, 2, row_count));
+  ASSERT_TRUE(value.is_valid());
+
+  const int64_t buf_len = value.size();
+  char *buf = static_cast<char *>(ob_malloc(buf_len, ObModIds::TEST));
+  ASSERT_NE(nullptr, buf);
+  ObIKVCacheValue *copy = nullptr;
+  ASSERT_EQ(OB_SUCCESS, value.deep_copy(buf, buf_len, copy));
+  ObDecodedColumnCacheValue *pvalue = static_cast<ObDecodedColumnCacheValue *>(copy);
+  ASSERT_EQ(2, pvalue->get_column_cnt());
+  ASSERT_EQ(row_count, pvalue->get_row_count());
+  for (int64_t i = 0; i < row_count; ++i) {
+    const ObDatum &int_datum = pvalue->get_column(0)[i];
+    const ObDatum &str_datum = pvalue->get_column(1)[i];
+    ASSERT_EQ(ints[i], int_datum.get_int());
+    ASSERT_TRUE(int_datum.ptr_ >= buf && int_datum.ptr_ < buf + buf_len);
+    if (nullptr == strs[i]) {
+      ASSERT_TRUE(str_datum.is_null());
+    } else {
+      ASSERT_EQ(0, str_datum.get_string().compare(ObString(strs[i])));
+      ASSERT_TRUE(str_datum.ptr_ >= buf && str_datum.ptr_ < buf + buf_len);
+    }
+  }
+  ob_free(buf);
+}
+
+TEST_F(TestDecodedColumnCacheScan, cache_hit_and_same_row_count)
+{
+  const MacroBlockId macro_id(0, 1, 0);
+  ObMicroBlockData block_a;
+  ObMicroBlockData block_b;
+  build_block(1, block_a);
+  build_block(2, block_b);
+
+  int64_t checksum_a = 0;
+  int64_t checksum_b = 0;
+  ASSERT_TRUE(ObDecodedColumnCacheKey::get_micro_data_checksum(block_a, checksum_a));
+  ASSERT_TRUE(ObDecodedColumnCacheKey::get_micro_data_checksum(block_b, checksum_b));
+  ASSERT_NE(checksum_a, checksum_b);
+  // without its header a block can not be told apart from others with the same row count
+  const ObMicroBlockHeader *header = block_a.get_micro_header();
+  ASSERT_NE(nullptr, header);
+  ObMicroBlockData payload_a(block_a.get_buf() + header->header_size_, block_a.get_buf_size() - header->header_size_);
+  int64_t no_checksum = 1;
+  ASSERT_FALSE(ObDecodedColumnCacheKey::get_micro_data_checksum(payload_a, no_checksum));
+  ASSERT_EQ(0, no_checksum);
+
+  ObDatum *columns_a[COLUMN_CNT];
+  ObDecodedColumnCacheValue value;
+  ObDecodedColumnValueHandle handle;
+  decode_block(block_a, columns_a);
+  ASSERT_EQ(OB_SUCCESS, value.init(columns_a, COLUMN_CNT, ROW_CNT));
+  const ObDecodedColumnCacheKey key_a(OB_SYS_TENANT_ID, macro_id, checksum_a, ROW_CNT, cols_projector_);
+  const ObDecodedColumnCacheKey key_b(OB_SYS_TENANT_ID, macro_id, checksum_b, ROW_CNT, cols_projector_);
+  ASSERT_EQ(OB_SUCCESS, cache_.put_and_fetch_columns(key_a, value, handle));
+  ASSERT_TRUE(handle.is_valid());
+  handle.reset();
+
+  // same macro block and row count, but a different micro block
+  ASSERT_EQ(OB_ENTRY_NOT_EXIST, cache_.get_columns(key_b, handle));
+  ASSERT_FALSE(handle.is_valid());
+
+  // a hit returns what a fresh decode of the block returns
+  ObDatum *expect_a[COLUMN_CNT];
+  ObDatum *expect_b[COLUMN_CNT];
+  decode_block(block_a, expect_a);
+  decode_block(block_b, expect_b);
+  ASSERT_EQ(OB_SUCCESS, cache_.get_columns(key_a, handle));
+  ASSERT_TRUE(handle.is_valid());
+  ASSERT_EQ(COLUMN_CNT, handle.value_->get_column_cnt());
+  ASSERT_EQ(ROW_CNT, handle.value_->get_row_count());
+  for (int64_t i = 0; i < COLUMN_CNT; ++i) {
+    const ObDatum *cached = handle.value_->get_column(i);
+    for (int64_t j = 0; j < ROW_CNT; ++j) {
+      ASSERT_TRUE(ObDatum::binary_equal(expect_a[i][j], cached[j])) << "col: " << i << " row: " << j;
+    }
+  }
+  ASSERT_EQ(1 * ROW_CNT + 7, handle.value_->get_column(1)[7].get_int());
+  ASSERT_FALSE(ObDatum::binary_equal(expect_b[1][7], handle.value_->get_column(1)[7]));
+  ASSERT_FALSE(ObDatum::binary_equal(expect_b[2][7], handle.value_->get_column(2)[7]));
+}
+
+TEST_F(TestDecodedColumnCacheScan, vector_store_scan_twice)
+{
+  const MacroBlockId macro_id(0, 2, 0);
+  const int64_t frame_size = (sizeof(ObDatum) + RES_BUF_LEN) * ROW_CNT * COLUMN_CNT;
+  // every other row, as a filtered scan selects them
+  const int64_t row_capacity = ROW_CNT / 2;
+  ObTenantBase tenant_base(OB_SYS_TENANT_ID);
+  ObTenantEnv::set_tenant(&tenant_base);
+  ObDecodedColumnCache &store_cache = OB_STORE_CACHE.get_decoded_column_cache();
+  ASSERT_EQ(OB_SUCCESS, store_cache.init("vector_decoded_column_cache", 1));
+
+  ObMicroBlockData block_data;
+  int64_t checksum = 0;
+  ObDatum *expect[COLUMN_CNT];
+  build_block(3, block_data);
+  decode_block(block_data, expect);
+  ASSERT_TRUE(ObDecodedColumnCacheKey::get_micro_data_checksum(block_data, checksum));
+  {
+    ObArenaAllocator stmt_allocator;
+    ObTableAccessContext context;
+    context.stmt_allocator_ = &stmt_allocator;
+    sql::ObExecContext exec_ctx(allocator_);
+    sql::ObEvalCtx eval_ctx(exec_ctx);
+    sql::ObExpr exprs[COLUMN_CNT];
+    ObVectorStore store(ROW_CNT, eval_ctx, context);
+    prepare_vector_store(store, exprs, frame_size);
+    for (int64_t j = 0; j < row_capacity; ++j) {
+      store.row_ids_[j] = j * 2;
+    }
+    store.set_micro_block_id(macro_id, true, checksum);
+    ObMicroBlockDecoder decoder;
+    ASSERT_EQ(OB_SUCCESS, decoder.init(block_data, read_info_));
+
+    // the first scan misses, decodes the whole block into the cache and fills from it
+    const ObDecodedColumnCacheKey key(OB_SYS_TENANT_ID, macro_id, checksum, ROW_CNT, cols_projector_);
+    ObDecodedColumnValueHandle handle;
+    bool filled = false;
+    ASSERT_EQ(OB_ENTRY_NOT_EXIST, store_cache.get_columns(key, handle));
+    ASSERT_EQ(OB_SUCCESS, store.fill_rows_from_decoded_cache(decoder, row_capacity, filled));
+    ASSERT_TRUE(filled);
+    ASSERT_EQ(OB_SUCCESS, store_cache.get_columns(key, handle));
+    handle.reset();
+    ObDatum first[COLUMN_CNT][ROW_CNT / 2];
+    for (int64_t i = 0; i < COLUMN_CNT; ++i) {
+      for (int64_t j = 0; j < row_capacity; ++j) {
+        ASSERT_EQ(OB_SUCCESS, first[i][j].deep_copy(store.datums_.at(i)[j], allocator_));
+      }
+    }
+
+    // the second scan hits, wipe the frame so every value has to be filled again
+    MEMSET(eval_ctx.frames_[0], 0, frame_size);
+    store.reuse();
+    store.set_micro_block_id(macro_id, true, checksum);
+    filled = false;
+    ASSERT_EQ(OB_SUCCESS, store.fill_rows_from_decoded_cache(decoder, row_capacity, filled));
+    ASSERT_TRUE(filled);
+    for (int64_t i = 0; i < COLUMN_CNT; ++i) {
+      const sql::ObExpr &expr = exprs[i];
+      const char *res_buf = eval_ctx.frames_[0] + expr.res_buf_off_;
+      for (int64_t j = 0; j < row_capacity; ++j) {
+        const ObDatum &datum = store.datums_.at(i)[j];
+        ASSERT_TRUE(ObDatum::binary_equal(first[i][j], datum)) << "col: " << i << " row: " << j;
+        ASSERT_TRUE(ObDatum::binary_equal(expect[i][j * 2], datum)) << "col: " << i << " row: " << j;
+        if (OBJ_DATUM_STRING != expr.obj_datum_map_) {
+          // fixed length values are copied into the result buffer of the expr
+          ASSERT_EQ(res_buf + RES_BUF_LEN * j, datum.ptr_);
+        }
+      }
+    }
+    ASSERT_EQ(3 * ROW_CNT + 10, store.datums_.at(1)[5].get_int());
+  }
+  store_cache.destroy();
+  ObTenantEnv::set_tenant(nullptr);
+}
+
+}
+}
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_decoded_column_cache.log*");
+  OB_LOGGER.set_file_name("test_decoded_column_cache.log", true, false);
+  OB_LOGGER.set_log_level("INFO");
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,262 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX STORAGE
+
+#include <gtest/gtest.h>
+#define private public
+#define protected public
+#include "ob_data_file_prepare.h"
+#include "lib/string/ob_sql_string.h"
+#include "share/ob_simple_mem_limit_getter.h"
+#include "share/rc/ob_tenant_base.h"
+#include "storage/blocksstable/ob_block_manager.h"
+#include "storage/blocksstable/ob_index_block_builder.h"
+#include "storage/blocksstable/ob_macro_block_writer.h"
+
+namespace oceanbase
+{
+using namespace common;
+using namespace blocksstable;
+using namespace storage;
+using namespace share;
+using namespace share::schema;
+static ObSimpleMemLimitGetter getter;
+
+namespace unittest
+{
+
+class TestMicroBlockCompressPipeline : public TestDataFilePrepare
+{
+public:
+  TestMicroBlockCompressPipeline()
+    : TestDataFilePrepare(&getter, "test_micro_block_compress_pipeline", OB_DEFAULT_MACRO_BLOCK_SIZE, 200),
+      tenant_base_(TENANT_ID),
+      table_schema_(),
+      index_schema_()
+  {}
+  virtual ~TestMicroBlockCompressPipeline() {}
+  static void SetUpTestCase();
+  static void TearDownTestCase();
+  virtual void SetUp();
+  virtual void TearDown();
+protected:
+  void prepare_schema();
+  void fill_row(const int64_t key, ObDatumRow &row);
+  void write_data_blocks(const bool enable_pipeline, ObIArray<ObString> &blocks);
+protected:
+  static const int64_t TEST_TABLE_ID = 50001;
+  static const int64_t TABLET_ID = 50001;
+  static const int64_t LS_ID = 1001;
+  static const int64_t SNAPSHOT_VERSION = 1000;
+  static const int64_t ROWKEY_COLUMN_CNT = 1;
+  static const int64_t COLUMN_CNT = 6;
+  static const int64_t ROW_CNT = 20000;
+  ObTenantBase tenant_base_;
+  ObTableSchema table_schema_;
+  ObTableSchema index_schema_;
+  ObArenaAllocator block_allocator_;
+};
+
+void TestMicroBlockCompressPipeline::SetUpTestCase()
+{
+  ASSERT_EQ(OB_SUCCESS, ObMicroBlockCompressPool::get_instance().init());
+}
+
+void TestMicroBlockCompressPipeline::TearDownTestCase()
+{
+  ObMicroBlockCompressPool::get_instance().destroy();
+}
+
+void TestMicroBlockCompressPipeline::SetUp()
+{
+  TestDataFilePrepare::SetUp();
+  // the pipeline compresses under the tenant of the writer
+  ObTenantEnv::set_tenant(&tenant_base_);
+  prepare_schema();
+}
+
+void TestMicroBlockCompressPipeline::TearDown()
+{
+  ObTenantEnv::set_tenant(nullptr);
+  block_allocator_.reset();
+  TestDataFilePrepare::TearDown();
+}
+
+void TestMicroBlockCompressPipeline::prepare_schema()
+{
+  ObColumnSchemaV2 column;
+  ObSqlString name;
+  ObTableSchema *schemas[] = { &table_schema_, &index_schema_ };
+  for (int64_t i = 0; i < 2; ++i) {
+    ObTableSchema &schema = *schemas[i];
+    schema.reset();
+    ASSERT_EQ(OB_SUCCESS, schema.set_table_name("test_micro_block_compress_pipeline"));
+    schema.set_tenant_id(TENANT_ID);
+    schema.set_tablegroup_id(1);
+    schema.set_database_id(1);
+    schema.set_table_id(TEST_TABLE_ID);
+    schema.set_rowkey_column_num(ROWKEY_COLUMN_CNT);
+    schema.set_max_used_column_id(OB_APP_MIN_COLUMN_ID + COLUMN_CNT);
+    // small micro blocks so that a macro block keeps several of them in flight
+    schema.set_block_size(4 * 1024);
+    schema.set_compress_func_name("lz4_1.0");
+    schema.set_row_store_type(ENCODING_ROW_STORE);
+    schema.set_storage_format_version(OB_STORAGE_FORMAT_VERSION_V4);
+  }
+  for (int64_t i = 0; i < COLUMN_CNT; ++i) {
+    column.reset();
+    column.set_table_id(TEST_TABLE_ID);
+    column.set_column_id(OB_APP_MIN_COLUMN_ID + i);
+    ASSERT_EQ(OB_SUCCESS, name.assign_fmt("c%ld", i));
+    ASSERT_EQ(OB_SUCCESS, column.set_column_name(name.ptr()));
+    column.set_rowkey_position(i < ROWKEY_COLUMN_CNT ? i + 1 : 0);
+    column.set_collation_type(CS_TYPE_UTF8MB4_BIN);
+    if (i < COLUMN_CNT / 2) {
+      column.set_data_type(ObIntType);
+    } else {
+      column.set_data_type(ObVarcharType);
+      column.set_data_length(32);
+    }
+    ASSERT_EQ(OB_SUCCESS, table_schema_.add_column(column));
+    if (i < ROWKEY_COLUMN_CNT) {
+      ASSERT_EQ(OB_SUCCESS, index_schema_.add_column(column));
+    }
+  }
+  column.reset();
+  column.set_table_id(TEST_TABLE_ID);
+  column.set_column_id(OB_APP_MIN_COLUMN_ID + COLUMN_CNT);
+  ASSERT_EQ(OB_SUCCESS, column.set_column_name("Index block data"));
+  column.set_data_type(ObVarcharType);
+  column.set_collation_type(CS_TYPE_BINARY);
+  column.set_data_length(1);
+  column.set_rowkey_position(0);
+  ASSERT_EQ(OB_SUCCESS, index_schema_.add_column(column));
+}
+
+void TestMicroBlockCompressPipeline::fill_row(const int64_t key, ObDatumRow &row)
+{
+  static const char *STR_VALUES[] = { "pipeline", "compress", "micro block", "macro block writer" };
+  const int64_t extra_rowkey_cnt = ObMultiVersionRowkeyHelpper::get_extra_rowkey_col_cnt();
+  row.reuse();
+  row.row_flag_.set_flag(ObDmlFlag::DF_INSERT);
+  row.mvcc_row_flag_.reset();
+  row.set_compacted_multi_version_row();
+  row.set_first_multi_version_row();
+  row.set_last_multi_version_row();
+  row.storage_datums_[0].set_int(key);
+  row.storage_datums_[ROWKEY_COLUMN_CNT].set_int(-SNAPSHOT_VERSION);
+  row.storage_datums_[ROWKEY_COLUMN_CNT + 1].set_int(0);
+  for (int64_t i = ROWKEY_COLUMN_CNT; i < COLUMN_CNT; ++i) {
+    ObStorageDatum &datum = row.storage_datums_[i + extra_rowkey_cnt];
+    if (i < COLUMN_CNT / 2) {
+      datum.set_int(key % (i * 100 + 7));
+    } else {
+      datum.set_string(ObString::make_string(STR_VALUES[(key / i) % 4]));
+    }
+  }
+  row.count_ = COLUMN_CNT + extra_rowkey_cnt;
+}
+
+// writes the same rows through ObMacroBlockWriter and returns a copy of every data macro block
+void TestMicroBlockCompressPipeline::write_data_blocks(const bool enable_pipeline, ObIArray<ObString> &blocks)
+{
+  ObDataStoreDesc data_desc;
+  ObDataStoreDesc index_desc;
+  ObSSTableIndexBuilder index_builder;
+  ObMacroBlockWriter writer;
+  ObMacroDataSeq start_seq(0);
+  ObDatumRow row;
+  ObArenaAllocator allocator;
+  start_seq.set_data_block();
+  GCONF._enable_parallel_micro_block_compress = enable_pipeline;
+
+  ASSERT_EQ(OB_SUCCESS, data_desc.init(table_schema_, ObLSID(LS_ID), ObTabletID(TABLET_ID),
+      MAJOR_MERGE, SNAPSHOT_VERSION, CLUSTER_VERSION_4_0_0_0));
+  ASSERT_EQ(OB_SUCCESS, index_desc.init(index_schema_, ObLSID(LS_ID), ObTabletID(TABLET_ID),
+      MAJOR_MERGE, SNAPSHOT_VERSION, CLUSTER_VERSION_4_0_0_0));
+  ASSERT_EQ(OB_SUCCESS, index_builder.init(index_desc));
+  data_desc.sstable_index_builder_ = &index_builder;
+  data_desc.need_prebuild_bloomfilter_ = false;
+  ASSERT_TRUE(data_desc.is_valid());
+  ASSERT_EQ(OB_SUCCESS, row.init(allocator, data_desc.row_column_count_));
+
+  ASSERT_EQ(OB_SUCCESS, writer.open(data_desc, start_seq));
+  ASSERT_EQ(enable_pipeline, nullptr != writer.compress_tasks_);
+  for (int64_t key = 0; key < ROW_CNT; ++key) {
+    fill_row(key, row);
+    ASSERT_EQ(OB_SUCCESS, writer.append_row(row));
+  }
+  ASSERT_EQ(OB_SUCCESS, writer.close());
+
+  ObIArray<MacroBlockId> &macro_ids = writer.get_macro_block_write_ctx().get_macro_block_list();
+  ASSERT_GT(macro_ids.count(), 0);
+  for (int64_t i = 0; i < macro_ids.count(); ++i) {
+    ObMacroBlockReadInfo read_info;
+    ObMacroBlockHandle macro_handle;
+    char *buf = nullptr;
+    read_info.macro_block_id_ = macro_ids.at(i);
+    read_info.offset_ = 0;
+    read_info.size_ = OB_DEFAULT_MACRO_BLOCK_SIZE;
+    read_info.io_desc_.set_category(ObIOCategory::SYS_IO);
+    read_info.io_desc_.set_wait_event(ObWaitEventIds::DB_FILE_DATA_READ);
+    ASSERT_EQ(OB_SUCCESS, ObBlockManager::read_block(read_info, macro_handle));
+    ASSERT_NE(nullptr, buf = static_cast<char *>(block_allocator_.alloc(read_info.size_)));
+    MEMCPY(buf, macro_handle.get_buffer(), read_info.size_);
+    ASSERT_EQ(OB_SUCCESS, blocks.push_back(ObString(read_info.size_, buf)));
+  }
+}
+
+TEST_F(TestMicroBlockCompressPipeline, test_output_identical)
+{
+  ObArray<ObString> serial_blocks;
+  ObArray<ObString> pipeline_blocks;
+  write_data_blocks(false, serial_blocks);
+  write_data_blocks(true, pipeline_blocks);
+  GCONF._enable_parallel_micro_block_compress = false;
+  ASSERT_EQ(serial_blocks.count(), pipeline_blocks.count());
+  for (int64_t i = 0; i < serial_blocks.count(); ++i) {
+    ASSERT_EQ(0, MEMCMP(serial_blocks.at(i).ptr(), pipeline_blocks.at(i).ptr(), serial_blocks.at(i).length()))
+        << "macro block " << i << " differs";
+  }
+}
+
+TEST_F(TestMicroBlockCompressPipeline, test_pool_stopped)
+{
+  // with the pool stopped every submit fails and the merge thread compresses inline,
+  // the output still has to match
+  ObArray<ObString> serial_blocks;
+  ObArray<ObString> pipeline_blocks;
+  write_data_blocks(false, serial_blocks);
+  ObMicroBlockCompressPool::get_instance().destroy();
+  ASSERT_EQ(OB_SUCCESS, ObMicroBlockCompressPool::get_instance().init());
+  ObMicroBlockCompressPool::get_instance().stop();
+  write_data_blocks(true, pipeline_blocks);
+  GCONF._enable_parallel_micro_block_compress = false;
+  ASSERT_EQ(serial_blocks.count(), pipeline_blocks.count());
+  for (int64_t i = 0; i < serial_blocks.count(); ++i) {
+    ASSERT_EQ(0, MEMCMP(serial_blocks.at(i).ptr(), pipeline_blocks.at(i).ptr(), serial_blocks.at(i).length()))
+        << "macro block " << i << " differs";
+  }
+}
+
+} // end namespace unittest
+} // end namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_micro_block_compress_pipeline.log*");
+  OB_LOGGER.set_file_name("test_micro_block_compress_pipeline.log");
+  OB_LOGGER.set_log_level("INFO");
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
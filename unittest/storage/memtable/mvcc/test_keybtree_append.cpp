@@ -0,0 +1,203 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include "storage/memtable/mvcc/ob_keybtree.h"
+
+#include "common/object/ob_object.h"
+#include "common/rowkey/ob_store_rowkey.h"
+#include "lib/allocator/ob_malloc.h"
+#include "lib/random/ob_random.h"
+#include "lib/time/ob_time_utility.h"
+#include "storage/memtable/ob_memtable_key.h"
+#include "storage/memtable/mvcc/ob_mvcc_row.h"
+
+#include <gtest/gtest.h>
+#include <thread>
+
+namespace oceanbase
+{
+namespace unittest
+{
+using namespace oceanbase::common;
+using namespace oceanbase::keybtree;
+using namespace oceanbase::memtable;
+
+#define IS_EQ(x, y) if ((x) != (y)) { abort(); }
+
+const char *attr = ObModIds::TEST;
+
+int alloc_key(BtreeKey *&ret_key, int64_t key)
+{
+  int ret = OB_SUCCESS;
+  ObObj *obj_ptr = nullptr;
+  ObStoreRowkey *storerowkey = nullptr;
+  if (OB_ISNULL(obj_ptr = (ObObj *)ob_malloc(sizeof(ObObj), attr)) || OB_ISNULL(new(obj_ptr)ObObj(key))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+  } else if (OB_ISNULL(storerowkey = (ObStoreRowkey *)ob_malloc(sizeof(ObStoreRowkey), attr)) || OB_ISNULL(new(storerowkey)ObStoreRowkey(obj_ptr, 1))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+  } else if (OB_ISNULL(ret_key = (BtreeKey *)ob_malloc(sizeof(BtreeKey), attr)) || OB_ISNULL(new(ret_key)BtreeKey(storerowkey))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+  }
+  return ret;
+}
+
+int64_t get_v(BtreeKey *ptr)
+{
+  int64_t tmp = 0;
+  IS_EQ(OB_SUCCESS, ptr->get_rowkey()->get_rowkey().get_obj_ptr()[0].get_int(tmp));
+  return tmp;
+}
+
+class FakeAllocator : public ObIAllocator
+{
+public:
+  void *alloc(int64_t size) override { return ob_malloc(size, attr); }
+  void* alloc(const int64_t size, const ObMemAttr &attr) override
+  {
+    UNUSED(attr);
+    return alloc(size);
+  }
+  void free(void *ptr) override { ob_free(ptr); }
+  static FakeAllocator*get_instance()
+  {
+    static FakeAllocator allocator;
+    return &allocator;
+  }
+};
+
+// Memtables of tables with an increasing primary key funnel all writers into the
+// right-most leaf, mix such appenders with random writers and concurrent scanners.
+TEST(TestKeyBtreeAppend, concurrent_append_and_scan)
+{
+  constexpr int64_t APPEND_THREAD_COUNT = 4;
+  constexpr int64_t RANDOM_INSERT_THREAD_COUNT = 2;
+  constexpr int64_t SCAN_THREAD_COUNT = 2;
+  constexpr int64_t INSERT_COUNT_PER_THREAD = (1 << 12);
+  constexpr int64_t APPEND_KEY_COUNT = APPEND_THREAD_COUNT * INSERT_COUNT_PER_THREAD;
+
+  BtreeNodeAllocator allocator(*FakeAllocator::get_instance());
+  ObKeyBtree btree(allocator);
+  ASSERT_EQ(OB_SUCCESS, btree.init());
+
+  CACHE_ALIGNED int64_t global_key = 0;
+  CACHE_ALIGNED int64_t random_insert_count = 0;
+  CACHE_ALIGNED bool should_stop = false;
+  const int64_t start_ts = ObTimeUtility::current_time();
+
+  std::thread append_threads[APPEND_THREAD_COUNT];
+  for (int64_t i = 0; i < APPEND_THREAD_COUNT; ++i) {
+    append_threads[i] = std::thread([&]() {
+      BtreeKey *tmp_key = nullptr;
+      int64_t key = 0;
+      while ((key = ATOMIC_FAA(&global_key, 1)) < APPEND_KEY_COUNT) {
+        BtreeVal v = (BtreeVal)(key << 3);
+        IS_EQ(OB_SUCCESS, alloc_key(tmp_key, key));
+        IS_EQ(OB_SUCCESS, btree.insert(*tmp_key, v));
+      }
+    });
+  }
+
+  std::thread random_insert_threads[RANDOM_INSERT_THREAD_COUNT];
+  for (int64_t i = 0; i < RANDOM_INSERT_THREAD_COUNT; ++i) {
+    random_insert_threads[i] = std::thread([&]() {
+      int ret = OB_SUCCESS;
+      BtreeKey *tmp_key = nullptr;
+      for (int64_t j = 0; j < INSERT_COUNT_PER_THREAD; ++j) {
+        // keep random keys away from the appended range so both can be verified
+        int64_t key = ObRandom::rand(APPEND_KEY_COUNT, 2 * APPEND_KEY_COUNT - 1);
+        BtreeVal v = (BtreeVal)(key << 3);
+        IS_EQ(OB_SUCCESS, alloc_key(tmp_key, key));
+        if (OB_SUCC(btree.insert(*tmp_key, v))) {
+          ATOMIC_INC(&random_insert_count);
+        } else {
+          IS_EQ(OB_ENTRY_EXIST, ret);
+        }
+      }
+    });
+  }
+
+  std::thread scan_threads[SCAN_THREAD_COUNT];
+  for (int64_t i = 0; i < SCAN_THREAD_COUNT; ++i) {
+    scan_threads[i] = std::thread([&]() {
+      int ret = OB_SUCCESS;
+      BtreeKey *start_key = nullptr;
+      BtreeKey *end_key = nullptr;
+      BtreeKey *tmp_key = nullptr;
+      BtreeVal tmp_value = nullptr;
+      IS_EQ(OB_SUCCESS, alloc_key(start_key, 0));
+      IS_EQ(OB_SUCCESS, alloc_key(end_key, INT64_MAX));
+      IS_EQ(OB_SUCCESS, alloc_key(tmp_key, 0));
+      while (!ATOMIC_LOAD(&should_stop)) {
+        BtreeIterator iter;
+        int64_t last = -1;
+        IS_EQ(OB_SUCCESS, btree.set_key_range(iter, *start_key, false, *end_key, true, 1));
+        while (OB_SUCC(iter.get_next(*tmp_key, tmp_value))) {
+          // a scan racing with splits must still see every key once and in order
+          IS_EQ(true, get_v(tmp_key) > last);
+          IS_EQ((int64_t)tmp_value >> 3, get_v(tmp_key));
+          last = get_v(tmp_key);
+        }
+        IS_EQ(OB_ITER_END, ret);
+      }
+    });
+  }
+
+  for (int64_t i = 0; i < APPEND_THREAD_COUNT; ++i) {
+    append_threads[i].join();
+  }
+  for (int64_t i = 0; i < RANDOM_INSERT_THREAD_COUNT; ++i) {
+    random_insert_threads[i].join();
+  }
+  const int64_t insert_cost = ObTimeUtility::current_time() - start_ts;
+  ATOMIC_STORE(&should_stop, true);
+  for (int64_t i = 0; i < SCAN_THREAD_COUNT; ++i) {
+    scan_threads[i].join();
+  }
+  const int64_t total_count = APPEND_KEY_COUNT + random_insert_count;
+  _OB_LOG(INFO, "concurrent append finished, keys=%ld cost=%ldus split_pos=%d",
+          total_count, insert_cost, btree.get_split_pos());
+  ASSERT_EQ(total_count, btree.size());
+
+  int ret = OB_SUCCESS;
+  BtreeIterator iter;
+  BtreeKey *start_key = nullptr;
+  BtreeKey *end_key = nullptr;
+  BtreeKey *tmp_key = nullptr;
+  BtreeVal tmp_value = nullptr;
+  int64_t count = 0;
+  ASSERT_EQ(OB_SUCCESS, alloc_key(start_key, 0));
+  ASSERT_EQ(OB_SUCCESS, alloc_key(end_key, INT64_MAX));
+  ASSERT_EQ(OB_SUCCESS, alloc_key(tmp_key, 0));
+  ASSERT_EQ(OB_SUCCESS, btree.set_key_range(iter, *start_key, false, *end_key, true, 1));
+  while (OB_SUCC(iter.get_next(*tmp_key, tmp_value))) {
+    if (count < APPEND_KEY_COUNT) {
+      ASSERT_EQ(count, get_v(tmp_key));
+    }
+    ASSERT_EQ((int64_t)tmp_value >> 3, get_v(tmp_key));
+    ++count;
+  }
+  ASSERT_EQ(OB_ITER_END, ret);
+  ASSERT_EQ(total_count, count);
+  iter.reset();
+  ASSERT_EQ(OB_SUCCESS, btree.destroy());
+}
+
+}
+}
+
+int main(int argc, char **argv)
+{
+  oceanbase::common::ObLogger::get_logger().set_file_name("test_keybtree_append.log", true);
+  oceanbase::common::ObLogger::get_logger().set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
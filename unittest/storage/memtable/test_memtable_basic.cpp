@@ -192,6 +192,7 @@ public:
 class RunCtxGuard
 {
 public:
+  static const int64_t MAX_BATCH_ROW_COUNT = 16;
   int init(int64_t trans_id, TestMemtable *tm) {
     tm_ = tm;
     trans_ctx_.trans_id_ = ObTransID(trans_id);
@@ -199,8 +200,7 @@ public:
     return mem_ctx_.init(MTL_ID());
   }
 
-  int write(int64_t key, int64_t val, ObMemtable &mt, ObDatumRowkey &row_key, int64_t snapshot_version = 1000) {
-    ObStoreCtx store_ctx;
+  void init_write_ctx(ObStoreCtx &store_ctx, ObTableStoreIterator &table_iter, int64_t snapshot_version) {
     ObTxSnapshot snapshot;
     ObTxTableGuard tx_table_guard;
     tx_table_guard.init((ObTxTable*)0x100);
@@ -214,12 +214,30 @@ public:
                                        snapshot,
                                        INT64_MAX,
                                        INT64_MAX);
-    ObTableStoreIterator table_iter;
     store_ctx.table_iter_ = &table_iter;
+  }
+  int write(int64_t key, int64_t val, ObMemtable &mt, ObDatumRowkey &row_key, int64_t snapshot_version = 1000) {
+    ObStoreCtx store_ctx;
+    ObTableStoreIterator table_iter;
+    init_write_ctx(store_ctx, table_iter, snapshot_version);
     ObStoreRow write_row;
     tm_->mock_row(key, val, row_key, write_row);
     return mt.set_(store_ctx, tm_->tablet_id_.id(), tm_->read_info_, tm_->columns_, write_row, NULL, NULL);
   }
+  int multi_write(const int64_t *keys, const int64_t row_count, int64_t val, ObMemtable &mt,
+                  int64_t snapshot_version = 1000) {
+    ObStoreCtx store_ctx;
+    ObTableStoreIterator table_iter;
+    init_write_ctx(store_ctx, table_iter, snapshot_version);
+    ObStoreRow write_rows[MAX_BATCH_ROW_COUNT];
+    OB_ASSERT(row_count <= MAX_BATCH_ROW_COUNT);
+    for (int64_t i = 0; i < row_count; i++) {
+      ObDatumRowkey row_key;
+      tm_->mock_row(keys[i], val, row_key, write_rows[i]);
+    }
+    return mt.multi_set_(store_ctx, tm_->tablet_id_.id(), tm_->read_info_, tm_->columns_,
+                         write_rows, row_count);
+  }
   int write(int64_t key, int64_t val, ObMemtable &mt, int64_t snapshot_version = 1000) {
     ObDatumRowkey row_key;
     return write(key, val, mt, row_key, snapshot_version);
@@ -413,6 +431,31 @@ TEST_F(TestMemtable, multi_key)
 }
 
 
+TEST_F(TestMemtable, multi_set)
+{
+  ObMemtable mt;
+  EXPECT_EQ(OB_SUCCESS, init_memtable(mt));
+
+  RunCtxGuard rg;
+  EXPECT_EQ(OB_SUCCESS, rg.init(1, this));
+  const int64_t keys[] = {1, 2, 3, 4};
+  EXPECT_EQ(OB_SUCCESS, rg.multi_write(keys, 4, 10, mt));
+  for (int64_t i = 0; i < 4; i++) {
+    int64_t val = 0;
+    EXPECT_EQ(OB_SUCCESS, rg.read(keys[i], val, mt, 1));
+  }
+
+  // rows of the batch locked by another transaction are still detected one by one
+  RunCtxGuard rg2;
+  EXPECT_EQ(OB_SUCCESS, rg2.init(2, this));
+  const int64_t keys2[] = {5, 3};
+  EXPECT_EQ(OB_ERR_EXCLUSIVE_LOCK_CONFLICT, rg2.multi_write(keys2, 2, 20, mt));
+  int64_t val = 0;
+  EXPECT_EQ(OB_SUCCESS, rg2.read(5, val, mt, 2));
+
+  EXPECT_EQ(OB_SUCCESS, rg.mem_ctx_.do_trans_end(true, 900, 900, 0));
+}
+
 }// end of oceanbase
 
 
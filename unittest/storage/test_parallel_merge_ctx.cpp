@@ -0,0 +1,119 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#define private public
+#define protected public
+#include "storage/compaction/ob_partition_parallel_merge_ctx.h"
+#include "lib/container/ob_se_array.h"
+
+namespace oceanbase
+{
+using namespace common;
+using namespace storage;
+
+namespace unittest
+{
+
+class TestParallelMergeCtx : public ::testing::Test
+{
+public:
+  TestParallelMergeCtx() = default;
+  void SetUp() {}
+  void TearDown() {}
+};
+
+// the over-split ranges are (last of prev range, last], the first one starts at the
+// min rowkey and the last one ends at the max rowkey, so they cover the key space
+// exactly once iff every macro block is the last of at most one range and the
+// last indexes are strictly increasing up to the last macro block
+void check_range_coverage(const int64_t macro_block_cnt, const int64_t concurrent_cnt)
+{
+  ObSEArray<int64_t, 16> last_macro_idxs;
+  SCOPED_TRACE(macro_block_cnt);
+  SCOPED_TRACE(concurrent_cnt);
+  ASSERT_EQ(OB_SUCCESS, ObParallelMergeCtx::get_major_range_last_macro_idxs(
+      macro_block_cnt, concurrent_cnt, last_macro_idxs));
+  ASSERT_EQ(concurrent_cnt, last_macro_idxs.count());
+  int64_t prev_last = -1;
+  int64_t covered_cnt = 0;
+  for (int64_t i = 0; i < last_macro_idxs.count(); ++i) {
+    const int64_t last = last_macro_idxs.at(i);
+    ASSERT_GT(last, prev_last);
+    covered_cnt += last - prev_last;
+    prev_last = last;
+  }
+  ASSERT_EQ(macro_block_cnt - 1, prev_last);
+  ASSERT_EQ(macro_block_cnt, covered_cnt);
+}
+
+TEST_F(TestParallelMergeCtx, major_split_covers_key_space)
+{
+  const int64_t thread_cnts[] = {1, 2, 3, 5, 8, 16, 64};
+  for (int64_t macro_block_cnt = 2; macro_block_cnt <= 500; ++macro_block_cnt) {
+    for (int64_t concurrent_cnt = 2; concurrent_cnt <= ObParallelMergeCtx::MAX_MERGE_THREAD; ++concurrent_cnt) {
+      for (int64_t t = 0; t < sizeof(thread_cnts) / sizeof(thread_cnts[0]); ++t) {
+        int64_t split_cnt = concurrent_cnt;
+        ASSERT_EQ(OB_SUCCESS, ObParallelMergeCtx::calc_major_split_cnt(
+            macro_block_cnt, thread_cnts[t], split_cnt));
+        // may shrink a little to keep the ranges equally sized, but never goes serial
+        ASSERT_GT(split_cnt, 1);
+        ASSERT_LE(split_cnt, ObParallelMergeCtx::MAX_MERGE_THREAD);
+        ASSERT_LE(split_cnt, macro_block_cnt);
+        check_range_coverage(macro_block_cnt, split_cnt);
+        if (HasFatalFailure()) {
+          return;
+        }
+      }
+    }
+  }
+}
+
+TEST_F(TestParallelMergeCtx, major_split_cnt)
+{
+  int64_t concurrent_cnt = 2;
+  // 4 ranges for each of the 8 threads
+  ASSERT_EQ(OB_SUCCESS, ObParallelMergeCtx::calc_major_split_cnt(1000, 8, concurrent_cnt));
+  ASSERT_EQ(8, concurrent_cnt);
+  concurrent_cnt = 8;
+  ASSERT_EQ(OB_SUCCESS, ObParallelMergeCtx::calc_major_split_cnt(1000, 8, concurrent_cnt));
+  ASSERT_EQ(32, concurrent_cnt);
+  // never more ranges than macro blocks
+  concurrent_cnt = 4;
+  ASSERT_EQ(OB_SUCCESS, ObParallelMergeCtx::calc_major_split_cnt(10, 8, concurrent_cnt));
+  ASSERT_EQ(10, concurrent_cnt);
+  // tablet_size smaller than a macro block asks for more ranges than blocks
+  concurrent_cnt = 12;
+  ASSERT_EQ(OB_SUCCESS, ObParallelMergeCtx::calc_major_split_cnt(10, 1, concurrent_cnt));
+  ASSERT_EQ(10, concurrent_cnt);
+  concurrent_cnt = 2;
+  ASSERT_EQ(OB_SUCCESS, ObParallelMergeCtx::calc_major_split_cnt(1, 8, concurrent_cnt));
+  ASSERT_EQ(1, concurrent_cnt);
+  concurrent_cnt = 1;
+  ASSERT_EQ(OB_INVALID_ARGUMENT, ObParallelMergeCtx::calc_major_split_cnt(10, 8, concurrent_cnt));
+  ObSEArray<int64_t, 16> last_macro_idxs;
+  ASSERT_EQ(OB_INVALID_ARGUMENT, ObParallelMergeCtx::get_major_range_last_macro_idxs(0, 2, last_macro_idxs));
+  ASSERT_EQ(OB_INVALID_ARGUMENT, ObParallelMergeCtx::get_major_range_last_macro_idxs(
+      100, ObParallelMergeCtx::MAX_MERGE_THREAD + 1, last_macro_idxs));
+}
+
+}
+}
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_parallel_merge_ctx.log*");
+  OB_LOGGER.set_file_name("test_parallel_merge_ctx.log", true, false);
+  OB_LOGGER.set_log_level("INFO");
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}